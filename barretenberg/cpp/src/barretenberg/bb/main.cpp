@@ -1,6 +1,7 @@
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/dsl/types.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/stdlib/recursion/aggregation_tree/aggregation_tree.hpp"
 #include "config.hpp"
 #include "get_bn254_crs.hpp"
 #include "get_bytecode.hpp"
@@ -234,6 +235,84 @@ bool verify(const std::string& proof_path, bool recursive, const std::string& vk
     return verified;
 }
 
+/**
+ * @brief Verifies several proofs of the same ACIR circuit at once
+ *
+ * The pairing checks of all proofs are combined into one, which is much cheaper than verifying each proof on its own.
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether all of the proofs are valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_paths Paths to the files containing the serialized proofs
+ * @param recursive Whether the proofs were generated with the recursive setting
+ * @param vk_path Path to the file containing the serialized verification key
+ * @return true If every proof is valid
+ * @return false If at least one proof is invalid
+ */
+bool batch_verify(const std::vector<std::string>& proof_paths, bool recursive, const std::string& vk_path)
+{
+    auto acir_composer = verifier_init();
+    auto vk_data = from_buffer<plonk::verification_key_data>(read_file(vk_path));
+    acir_composer.load_verification_key(std::move(vk_data));
+
+    std::vector<std::vector<uint8_t>> proofs;
+    proofs.reserve(proof_paths.size());
+    for (auto const& proof_path : proof_paths) {
+        proofs.push_back(read_file(proof_path));
+    }
+    auto verified = acir_composer.batch_verify_proofs(proofs, recursive);
+
+    vinfo("verified ", proofs.size(), " proofs: ", verified);
+    return verified;
+}
+
+/**
+ * @brief Aggregates several proofs of the same ACIR circuit into a single proof
+ *
+ * The proofs are verified `arity` at a time inside recursive verifier circuits, level by level, until one proof
+ * remains. Its public inputs are those of every input proof, in order, followed by the aggregation object, and it can
+ * be checked with `verify -r` against the verification key written next to it.
+ *
+ * Communication:
+ * - Filesystem: The aggregated proof is written to the path specified by outputPath, and its verification key to
+ *   outputPath + "_vk"
+ *
+ * @param proof_paths Paths to the files containing proofs generated with the recursive setting
+ * @param vk_path Path to the file containing the serialized verification key of the proven circuit
+ * @param arity Number of proofs verified by each node of the aggregation tree
+ * @param outputPath Path to write the aggregated proof to
+ */
+void aggregate(const std::vector<std::string>& proof_paths,
+               const std::string& vk_path,
+               size_t arity,
+               const std::string& outputPath)
+{
+    plonk::stdlib::recursion::AggregationTree tree(arity);
+
+    // Must +1!
+    auto g1_data = get_bn254_g1_data(CRS_PATH, tree.get_max_node_circuit_size() + 1);
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory(g1_data, g2_data);
+
+    auto vk_data = from_buffer<plonk::verification_key_data>(read_file(vk_path));
+    auto verification_key =
+        std::make_shared<plonk::verification_key>(std::move(vk_data), srs::get_crs_factory()->get_verifier_crs());
+
+    std::vector<plonk::proof> proofs;
+    proofs.reserve(proof_paths.size());
+    for (auto const& proof_path : proof_paths) {
+        proofs.push_back({ read_file(proof_path) });
+    }
+
+    auto root = tree.aggregate(proofs, verification_key);
+
+    write_file(outputPath, root.proof.proof_data);
+    write_file(outputPath + "_vk", to_buffer(*root.verification_key));
+    vinfo("aggregated ", proofs.size(), " proofs using ", tree.get_num_proving_keys_computed(), " proving keys");
+    vinfo("proof written to: ", outputPath);
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -423,6 +502,21 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Returns the values following `option` up to the next argument starting with '-'.
+ */
+std::vector<std::string> get_option_list(std::vector<std::string>& args, const std::string& option)
+{
+    std::vector<std::string> values;
+    auto itr = std::find(args.begin(), args.end(), option);
+    if (itr != args.end()) {
+        for (++itr; itr != args.end() && !itr->starts_with("-"); ++itr) {
+            values.push_back(*itr);
+        }
+    }
+    return values;
+}
+
 int main(int argc, char* argv[])
 {
     try {
@@ -467,6 +561,15 @@ int main(int argc, char* argv[])
             gateCount(bytecode_path);
         } else if (command == "verify") {
             return verify(proof_path, recursive, vk_path) ? 0 : 1;
+        } else if (command == "batch_verify") {
+            auto proof_paths = get_option_list(args, "-p");
+            if (proof_paths.empty()) {
+                proof_paths.push_back(proof_path);
+            }
+            return batch_verify(proof_paths, recursive, vk_path) ? 0 : 1;
+        } else if (command == "aggregate") {
+            std::string output_path = get_option(args, "-o", "./proofs/aggregate");
+            aggregate(get_option_list(args, "-p"), vk_path, std::stoul(get_option(args, "-a", "2")), output_path);
         } else if (command == "contract") {
             std::string output_path = get_option(args, "-o", "./target/contract.sol");
             contract(output_path, vk_path);
@@ -7,6 +7,8 @@
  * simplify the codebase.
  */
 
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -18,9 +20,12 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -74,6 +79,83 @@ template <class Curve> class CommitmentKey {
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Uses the ProverSRS to create commitments to several polynomials
+     * @details Polynomials large enough for Pippenger are committed to one after the other, each MSM being
+     * multi-threaded. The remaining small polynomials, for which pippenger would run Straus' algorithm on a few threads
+     * of its own, are concatenated and split across threads together: each thread runs Straus' algorithm
+     * (`Element::batch_mul`) on the part of every polynomial that falls in its range of terms.
+     *
+     * @param polynomials univariate polynomials p_j(X)
+     * @return Commitments [p_j(x)]
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        using Element = typename Curve::Element;
+        using AffineElement = typename Curve::AffineElement;
+
+        // Up to this size, pippenger uses Straus' algorithm rather than bucket sums
+        const size_t straus_threshold =
+            std::max(get_num_cpus_pow2() * 8, barretenberg::scalar_multiplication::STRAUS_MAX_POINTS);
+
+        std::vector<Commitment> commitments(polynomials.size());
+        std::vector<size_t> small_indices;
+        std::vector<size_t> small_offsets{ 0 };
+        for (size_t j = 0; j < polynomials.size(); ++j) {
+            if (polynomials[j].size() > straus_threshold) {
+                commitments[j] = commit(polynomials[j]);
+            } else {
+                ASSERT(polynomials[j].size() <= srs->get_monomial_size());
+                small_indices.emplace_back(j);
+                small_offsets.emplace_back(small_offsets.back() + polynomials[j].size());
+            }
+        }
+        if (small_indices.empty()) {
+            return commitments;
+        }
+
+        // Each thread sums the terms of a contiguous range of the concatenated small polynomials
+        const size_t num_terms = small_offsets.back();
+        const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(
+            num_terms, barretenberg::scalar_multiplication::STRAUS_MIN_POINTS_PER_THREAD);
+        const size_t terms_per_thread = (num_terms + num_threads - 1) / num_threads;
+        std::vector<std::vector<Element>> thread_sums(num_threads,
+                                                      std::vector<Element>(small_indices.size(), Element::infinity()));
+        const auto* srs_points = srs->get_monomial_points();
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * terms_per_thread;
+            const size_t end = std::min(start + terms_per_thread, num_terms);
+            std::vector<AffineElement> points;
+            for (size_t poly_idx = 0; poly_idx < small_indices.size(); ++poly_idx) {
+                const size_t segment_start = std::max(start, small_offsets[poly_idx]);
+                const size_t segment_end = std::min(end, small_offsets[poly_idx + 1]);
+                if (segment_start >= segment_end) {
+                    continue;
+                }
+                const size_t first_coefficient = segment_start - small_offsets[poly_idx];
+                const size_t num_coefficients = segment_end - segment_start;
+                // The SRS is a pippenger point table: the monomial points are at even indices
+                points.clear();
+                for (size_t i = 0; i < num_coefficients; ++i) {
+                    points.emplace_back(srs_points[2 * (first_coefficient + i)]);
+                }
+                thread_sums[thread_idx][poly_idx] = Element::batch_mul(
+                    points, polynomials[small_indices[poly_idx]].subspan(first_coefficient, num_coefficients));
+            }
+        });
+
+        std::vector<Element> sums(small_indices.size(), Element::infinity());
+        for (const auto& thread_sum : thread_sums) {
+            for (size_t i = 0; i < sums.size(); ++i) {
+                sums[i] += thread_sum[i];
+            }
+        }
+        for (size_t i = 0; i < sums.size(); ++i) {
+            commitments[small_indices[i]] = Commitment(sums[i]);
+        }
+        return commitments;
+    };
+
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
 };
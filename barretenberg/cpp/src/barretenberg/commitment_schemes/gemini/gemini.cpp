@@ -1,6 +1,7 @@
 
 #include "gemini.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 
 #include <bit>
 #include <memory>
@@ -47,6 +48,11 @@ namespace proof_system::honk::pcs::gemini {
 /**
  * @brief Computes d-1 fold polynomials Fold_i, i = 1, ..., d-1
  *
+ * @details The fold polynomials share a single buffer, in which each is followed by one zero coefficient for its shift
+ * padding. Since Aₗ₊ₜ[j] only depends on the coefficients [2ᵗj, 2ᵗ(j+1)) of Aₗ, each thread folds its own contiguous
+ * chunk of A₀ through all the levels at which every thread still has some coefficients, without synchronising between
+ * levels. The few remaining levels are folded by a single thread. A₀ = F + G↺ itself is read directly from F and G.
+ *
  * @param mle_opening_point multilinear opening point 'u'
  * @param batched_unshifted F(X) = ∑ⱼ ρʲ   fⱼ(X)
  * @param batched_to_be_shifted G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
@@ -59,8 +65,8 @@ std::vector<typename barretenberg::Polynomial<typename Curve::ScalarField>> Gemi
                                        Polynomial&& batched_to_be_shifted)
 {
     const size_t num_variables = mle_opening_point.size(); // m
+    const size_t n = size_t(1) << num_variables;
 
-    const size_t num_threads = get_num_cpus_pow2();
     constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
                                                            // would be a point in sending them to a separate thread
 
@@ -73,56 +79,64 @@ std::vector<typename barretenberg::Polynomial<typename Curve::ScalarField>> Gemi
     gemini_polynomials.reserve(num_variables + 1);
 
     // F(X) = ∑ⱼ ρʲ fⱼ(X) and G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
-    Polynomial& batched_F = gemini_polynomials.emplace_back(std::move(batched_unshifted));
-    Polynomial& batched_G = gemini_polynomials.emplace_back(std::move(batched_to_be_shifted));
-    constexpr size_t offset_to_folded = 2; // Offset because of F an G
-    // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X.
-    Polynomial A_0 = batched_F;
-    A_0 += batched_G.shifted();
-
-    // Allocate everything before parallel computation
-    for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        gemini_polynomials.emplace_back(Polynomial(n_l));
+    const Polynomial& batched_F = gemini_polynomials.emplace_back(std::move(batched_unshifted));
+    const Polynomial& batched_G = gemini_polynomials.emplace_back(std::move(batched_to_be_shifted));
+    if (num_variables < 2) {
+        return gemini_polynomials;
     }
 
-    // A_l = Aₗ(X) is the polynomial being folded
-    // in the first iteration, we take the batched polynomial
-    // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
-    for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
+    // Offsets of the folds Aₗ, l = 1, ..., m-1, of size nₗ = n/2ˡ, in the buffer of all folds. The padding of the last
+    // fold is that of the buffer itself.
+    std::vector<size_t> fold_offsets(num_variables);
+    size_t buffer_size = 0;
+    for (size_t l = 1; l < num_variables; ++l) {
+        fold_offsets[l] = buffer_size;
+        buffer_size += (n >> l) + 1;
+    }
+    Polynomial folds(buffer_size - 1);
 
+    // Aₗ₊₁[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j] for j in [start, end)
+    const auto fold = [&](size_t l, size_t start, size_t end) {
         // Openning point is the same for all
         const Fr u_l = mle_opening_point[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = gemini_polynomials[l + offset_to_folded].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
+        Fr* A_l_fold = &folds[fold_offsets[l + 1]];
+        if (l == 0) {
+            // A₀[i] = F[i] + G[i + 1]
+            for (size_t j = start; j < end; ++j) {
+                const Fr A_0_even = batched_F[j << 1] + batched_G[(j << 1) + 1];
+                const Fr A_0_odd = batched_F[(j << 1) + 1] + batched_G[(j << 1) + 2];
+                A_l_fold[j] = A_0_even + u_l * (A_0_odd - A_0_even);
+            }
+        } else {
+            const Fr* A_l = &folds[fold_offsets[l]];
+            for (size_t j = start; j < end; ++j) {
                 // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
                 //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
                 //            = Aₗ₊₁[j]
                 A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
             }
-        });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        }
+    };
+
+    // Use as many threads as it is useful so that 1 thread doesn't process 1 element
+    const size_t num_threads =
+        barretenberg::thread_utils::calculate_num_threads_pow2(n >> 1, efficient_operations_per_thread);
+    size_t num_parallel_levels = 0;
+    while (num_parallel_levels < num_variables - 1 && (n >> (num_parallel_levels + 1)) >= num_threads) {
+        ++num_parallel_levels;
+    }
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        for (size_t l = 0; l < num_parallel_levels; ++l) {
+            const size_t chunk_size = (n >> (l + 1)) / num_threads;
+            fold(l, thread_idx * chunk_size, (thread_idx + 1) * chunk_size);
+        }
+    });
+    for (size_t l = num_parallel_levels; l < num_variables - 1; ++l) {
+        fold(l, 0, n >> (l + 1));
+    }
+
+    for (size_t l = 1; l < num_variables; ++l) {
+        gemini_polynomials.emplace_back(folds.share(fold_offsets[l], n >> l));
     }
 
     return gemini_polynomials;
@@ -142,7 +142,7 @@ template <typename Curve> class GeminiVerifier_ {
         commitments.reserve(num_variables - 1);
         for (size_t i = 0; i < num_variables - 1; ++i) {
             auto commitment =
-                transcript->template receive_from_prover<Commitment>("Gemini:FOLD_" + std::to_string(i + 1));
+                transcript->template receive_from_prover<Commitment>({ "Gemini:FOLD_", i + 1 });
             commitments.emplace_back(commitment);
         }
 
@@ -154,7 +154,7 @@ template <typename Curve> class GeminiVerifier_ {
         std::vector<Fr> evaluations;
         evaluations.reserve(num_variables);
         for (size_t i = 0; i < num_variables; ++i) {
-            auto eval = transcript->template receive_from_prover<Fr>("Gemini:a_" + std::to_string(i));
+            auto eval = transcript->template receive_from_prover<Fr>({ "Gemini:a_", i });
             evaluations.emplace_back(eval);
         }
 
@@ -59,10 +59,12 @@ template <class Curve> class GeminiTest : public CommitmentTest<Curve> {
         auto gemini_polynomials = GeminiProver::compute_gemini_polynomials(
             multilinear_evaluation_point, std::move(batched_unshifted), std::move(batched_to_be_shifted));
 
+        std::vector<std::span<const Fr>> fold_polynomials(gemini_polynomials.begin() + 2, gemini_polynomials.end());
+        auto fold_commitments = this->ck()->batch_commit(fold_polynomials);
         for (size_t l = 0; l < log_n - 1; ++l) {
             std::string label = "FOLD_" + std::to_string(l + 1);
-            auto commitment = this->ck()->commit(gemini_polynomials[l + 2]);
-            prover_transcript->send_to_verifier(label, commitment);
+            EXPECT_EQ(fold_commitments[l], this->ck()->commit(gemini_polynomials[l + 2]));
+            prover_transcript->send_to_verifier(label, fold_commitments[l]);
         }
 
         const Fr r_challenge = prover_transcript->get_challenge("Gemini:r");
@@ -238,4 +240,42 @@ TYPED_TEST(GeminiTest, DoubleWithShift)
                                            multilinear_commitments_to_be_shifted);
 }
 
+TYPED_TEST(GeminiTest, DoubleWithShiftLarge)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using GroupElement = typename TypeParam::Element;
+
+    // large enough for the first folds to be split across threads, and committed to with pippenger
+    const size_t n = 1024;
+    const size_t log_n = 10;
+
+    auto u = this->random_evaluation_point(log_n);
+
+    auto poly1 = this->random_polynomial(n);
+    auto poly2 = this->random_polynomial(n);
+    poly2[0] = Fr::zero(); // necessary for polynomial to be 'shiftable'
+
+    auto commitment1 = this->commit(poly1);
+    auto commitment2 = this->commit(poly2);
+
+    auto eval1 = poly1.evaluate_mle(u);
+    auto eval2 = poly2.evaluate_mle(u);
+    auto eval2_shift = poly2.evaluate_mle(u, true);
+
+    // Collect multilinear polynomials evaluations, and commitments for input to prover/verifier
+    std::vector<Fr> multilinear_evaluations = { eval1, eval2, eval2_shift };
+    std::vector<std::span<Fr>> multilinear_polynomials = { poly1, poly2 };
+    std::vector<std::span<Fr>> multilinear_polynomials_to_be_shifted = { poly2 };
+    std::vector<GroupElement> multilinear_commitments = { commitment1, commitment2 };
+    std::vector<GroupElement> multilinear_commitments_to_be_shifted = { commitment2 };
+
+    this->execute_gemini_and_verify_claims(log_n,
+                                           u,
+                                           multilinear_evaluations,
+                                           multilinear_polynomials,
+                                           multilinear_polynomials_to_be_shifted,
+                                           multilinear_commitments,
+                                           multilinear_commitments_to_be_shifted);
+}
+
 } // namespace proof_system::honk::pcs::gemini
@@ -2,11 +2,18 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 /**
@@ -27,6 +34,15 @@ template <typename Curve> class IPA {
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point
      *
+     * @details The vector b_vec = (1, β, β², ...) of powers of the evaluation point is never materialised: it stays a
+     * multiple of (1, β, ..., β^{m-1}) when folded, b_next[j] = u⁻¹·b[j] + u·b[m + j] = (u⁻¹ + u·β^m)·b[j], so only its
+     * scale is tracked. Likewise the generators are kept as G_vec = G_scale·G', so that each fold
+     * G_next = u⁻¹·G_lo + u·G_hi = (G_scale·u⁻¹)·(G'_lo + u²·G'_hi) takes a single batch multiplication.
+     *
+     * The first round reads the coefficients and the SRS points in place; the folded vectors live in buffers of half
+     * the polynomial size that are reused by every later round. Folding of the coefficients is fused with the inner
+     * products of the next round, and all loops are split across threads.
+     *
      * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
      * @param opening_pair (challenge, evaluation)
      * @param polynomial The witness polynomial whose opening proof needs to be computed
@@ -49,83 +65,105 @@ template <typename Curve> class IPA {
         ASSERT((poly_degree > 0) && (!(poly_degree & (poly_degree - 1))) &&
                "The poly_degree should be positive and a power of two");
 
-        auto a_vec = polynomial;
-        auto srs_elements = ck->srs->get_monomial_points();
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
-        }
-        std::vector<Fr> b_vec(poly_degree);
-        Fr b_power = 1;
-        for (size_t i = 0; i < poly_degree; i++) {
-            b_vec[i] = b_power;
-            b_power *= opening_pair.challenge;
-        }
-        // Iterate for log(poly_degree) rounds to compute the round commitments.
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
-        std::vector<GroupElement> L_elements(log_poly_degree);
-        std::vector<GroupElement> R_elements(log_poly_degree);
-        std::size_t round_size = poly_degree;
-
-        // TODO(#479): restructure IPA so it can be integrated with the pthread alternative to work queue (or even the
-        // work queue itself). Investigate whether parallelising parts of each rounds of IPA rounds brings significant
-        // improvements and see if reducing the size of G_vec_local and b_vec by taking the first iteration out of the
-        // loop can also be integrated.
+        if (log_poly_degree == 0) {
+            transcript->send_to_verifier("IPA:a_0", polynomial[0]);
+            return;
+        }
+
+        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
+        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism.
+        // The first round uses it as is: its halves are point tables of the low and high generators.
+        auto* srs_elements = ck->srs->get_monomial_points();
+
+        const size_t half_degree = poly_degree >> 1;
+        const std::vector<Fr> beta_powers = compute_powers(opening_pair.challenge, half_degree);
+
+        // Round buffers: folded coefficients and (unscaled) generators, and a pippenger point table for the MSMs of
+        // rounds after the first, which are at most half_degree / 2 points long.
+        std::vector<Fr> a_vec(half_degree);
+        std::vector<Commitment> G_vec(half_degree);
+        std::vector<Commitment> point_table(half_degree);
+        std::vector<GroupElement> fold_scratch(half_degree);
+
+        Fr b_scale = Fr::one();
+        Fr G_scale = Fr::one();
+        auto [sum_lo, sum_hi] = compute_inner_sums(polynomial.data().get(), half_degree, beta_powers);
+
         for (size_t i = 0; i < log_poly_degree; i++) {
-            round_size >>= 1;
-            // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
-            Fr inner_prod_L = Fr::zero();
-            Fr inner_prod_R = Fr::zero();
-            for (size_t j = 0; j < round_size; j++) {
-                inner_prod_L += a_vec[j] * b_vec[round_size + j];
-                inner_prod_R += a_vec[round_size + j] * b_vec[j];
-            }
-            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] =
-                // TODO(#473)
-                barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                    &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
-            L_elements[i] += aux_generator * inner_prod_L;
+            const size_t round_size = poly_degree >> (i + 1);
+            Fr* a_lo = (i == 0) ? const_cast<Fr*>(polynomial.data().get()) : a_vec.data();
+            Fr* a_hi = a_lo + round_size;
+
+            // inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
+            const Fr beta_pow_round_size = opening_pair.challenge.pow(static_cast<uint64_t>(round_size));
+            const Fr inner_prod_L = b_scale * beta_pow_round_size * sum_lo;
+            const Fr inner_prod_R = b_scale * sum_hi;
 
+            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            // TODO(#473)
-            R_elements[i] = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
-            R_elements[i] += aux_generator * inner_prod_R;
+            GroupElement L_i;
+            GroupElement R_i;
+            if (i == 0) {
+                L_i = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+                    a_lo, &srs_elements[2 * round_size], round_size, ck->pippenger_runtime_state);
+                R_i = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+                    a_hi, &srs_elements[0], round_size, ck->pippenger_runtime_state);
+            } else {
+                barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &G_vec[round_size], &point_table[0], round_size);
+                L_i = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+                    a_lo, &point_table[0], round_size, ck->pippenger_runtime_state);
+                barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &G_vec[0], &point_table[0], round_size);
+                R_i = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+                    a_hi, &point_table[0], round_size, ck->pippenger_runtime_state);
+                L_i = L_i * G_scale;
+                R_i = R_i * G_scale;
+            }
+            L_i += aux_generator * inner_prod_L;
+            R_i += aux_generator * inner_prod_R;
 
-            std::string index = std::to_string(i);
-            transcript->send_to_verifier("IPA:L_" + index, Commitment(L_elements[i]));
-            transcript->send_to_verifier("IPA:R_" + index, Commitment(R_elements[i]));
+            transcript->send_to_verifier({ "IPA:L_", i }, Commitment(L_i));
+            transcript->send_to_verifier({ "IPA:R_", i }, Commitment(R_i));
 
             // Generate the round challenge.
-            const Fr round_challenge = transcript->get_challenge("IPA:round_challenge_" + index);
+            const Fr round_challenge = transcript->get_challenge({ "IPA:round_challenge_", i });
             const Fr round_challenge_inv = round_challenge.invert();
 
-            std::vector<Commitment> G_lo(G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size));
-            std::vector<Commitment> G_hi(G_vec_local.begin() + static_cast<long>(round_size), G_vec_local.end());
-            G_lo = GroupElement::batch_mul_with_endomorphism(G_lo, round_challenge_inv);
-            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge);
-
             // Update the vectors a_vec, b_vec and G_vec.
             // a_vec_next = a_vec_lo * round_challenge + a_vec_hi * round_challenge_inv
             // b_vec_next = b_vec_lo * round_challenge_inv + b_vec_hi * round_challenge
             // G_vec_next = G_vec_lo * round_challenge_inv + G_vec_hi * round_challenge
-            for (size_t j = 0; j < round_size; j++) {
-                a_vec[j] *= round_challenge;
-                a_vec[j] += round_challenge_inv * a_vec[round_size + j];
-                b_vec[j] *= round_challenge_inv;
-                b_vec[j] += round_challenge * b_vec[round_size + j];
-
-                G_vec_local[j] = G_lo[j] + G_hi[j];
+            std::tie(sum_lo, sum_hi) =
+                fold_coefficients(a_lo, a_vec.data(), round_size, round_challenge, round_challenge_inv, beta_powers);
+            b_scale *= round_challenge_inv + round_challenge * beta_pow_round_size;
+            // The generators are not needed after the last round
+            if (i + 1 < log_poly_degree) {
+                const Commitment* G_lo = (i == 0) ? srs_elements : G_vec.data();
+                const size_t stride = (i == 0) ? 2 : 1;
+                fold_generators(G_lo, stride, G_vec.data(), round_size, round_challenge.sqr(), fold_scratch);
+                G_scale *= round_challenge_inv;
             }
         }
 
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
     }
 
+    /**
+     * @brief An IPA opening whose check has been reduced to C_zero = a_zero·G_zero, where G_zero = <s_vec, G_vec> is the
+     * generator folded with the round challenges.
+     * @details The folded generator is the only part of the check that costs an MSM of the size of the polynomial. It is
+     * left to batch_verify, which shares it across all the claims of a batch.
+     */
+    struct DeferredCheck {
+        // C_prime + ∑ u_j^2·L_j + ∑ u_j^{-2}·R_j - a_zero·b_zero·aux_generator
+        GroupElement C_zero;
+        Fr a_zero;
+        std::vector<Fr> round_challenges;
+        std::vector<Fr> round_challenges_inv;
+    };
+
     /**
      * @brief Verify the correctness of a Proof
      *
@@ -138,6 +176,22 @@ template <typename Curve> class IPA {
     static bool verify(const std::shared_ptr<VK>& vk,
                        const OpeningClaim<Curve>& opening_claim,
                        const std::shared_ptr<BaseTranscript>& transcript)
+    {
+        const DeferredCheck check = reduce_verify(vk, opening_claim, transcript);
+        return batch_verify(vk, { &check, 1 });
+    }
+
+    /**
+     * @brief Read a proof from the transcript and perform all of its verification but the MSM computing G_zero
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claim The claimed evaluation and the commitment to the polynomial
+     * @param transcript Verifier transcript holding the proof
+     * @return The remaining check, to be passed to batch_verify
+     */
+    static DeferredCheck reduce_verify(const std::shared_ptr<VK>& vk,
+                                       const OpeningClaim<Curve>& opening_claim,
+                                       const std::shared_ptr<BaseTranscript>& transcript)
     {
         auto poly_degree = static_cast<size_t>(transcript->template receive_from_prover<uint64_t>("IPA:poly_degree"));
         const Fr generator_challenge = transcript->get_challenge("IPA:generator_challenge");
@@ -150,15 +204,17 @@ template <typename Curve> class IPA {
 
         // Compute C_zero = C_prime + ∑_{j ∈ [k]} u_j^2L_j + ∑_{j ∈ [k]} u_j^{-2}R_j
         auto pippenger_size = 2 * log_poly_degree;
-        std::vector<Fr> round_challenges(log_poly_degree);
-        std::vector<Fr> round_challenges_inv(log_poly_degree);
+        DeferredCheck check;
+        auto& round_challenges = check.round_challenges;
+        auto& round_challenges_inv = check.round_challenges_inv;
+        round_challenges.resize(log_poly_degree);
+        round_challenges_inv.resize(log_poly_degree);
         std::vector<Commitment> msm_elements(pippenger_size);
         std::vector<Fr> msm_scalars(pippenger_size);
         for (size_t i = 0; i < log_poly_degree; i++) {
-            std::string index = std::to_string(i);
-            auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
-            auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
-            round_challenges[i] = transcript->get_challenge("IPA:round_challenge_" + index);
+            auto element_L = transcript->template receive_from_prover<Commitment>({ "IPA:L_", i });
+            auto element_R = transcript->template receive_from_prover<Commitment>({ "IPA:R_", i });
+            round_challenges[i] = transcript->get_challenge({ "IPA:round_challenge_", i });
             round_challenges_inv[i] = round_challenges[i].invert();
 
             msm_elements[2 * i] = element_L;
@@ -185,40 +241,208 @@ template <typename Curve> class IPA {
                       (round_challenges[log_poly_degree - 1 - i] * opening_claim.opening_pair.challenge.pow(exponent));
         }
 
-        // Compute G_zero
-        // First construct s_vec
+        check.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        check.C_zero = C_zero - aux_generator * (check.a_zero * b_zero);
+        return check;
+    }
+
+    /**
+     * @brief Complete a batch of reduced IPA checks with a single MSM over the SRS
+     *
+     * @details Each check is C_zero_i = a_zero_i·<s_vec_i, G_vec>. They are combined with random scalars r_i into
+     * ∑ r_i·C_zero_i = <∑ r_i·a_zero_i·s_vec_i, G_vec>, so the generators enter a single MSM whatever the size of the
+     * batch, and the left-hand side is an MSM with one point per claim. Claims may have different sizes: a shorter
+     * s_vec is zero-padded. As with batch_pairing_check, the first scalar is 1 and the others are 128-bit.
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param checks The outputs of reduce_verify
+     * @param engine Source of the random scalars; defaults to the secure engine
+     * @return true if every check holds (with overwhelming probability)
+     */
+    static bool batch_verify(const std::shared_ptr<VK>& vk,
+                             std::span<const DeferredCheck> checks,
+                             numeric::random::Engine* engine = nullptr)
+    {
+        if (checks.empty()) {
+            return true;
+        }
+        if (engine == nullptr) {
+            engine = &numeric::random::get_engine();
+        }
+
+        size_t poly_degree = 0;
+        for (const auto& check : checks) {
+            poly_degree = std::max(poly_degree, size_t(1) << check.round_challenges.size());
+        }
+        ASSERT(poly_degree <= vk->srs->get_monomial_size());
+
+        GroupElement lhs = checks[0].C_zero;
+        std::vector<Fr> s_vec_sum(poly_degree, Fr::zero());
         std::vector<Fr> s_vec(poly_degree);
-        for (size_t i = 0; i < poly_degree; i++) {
-            Fr s_vec_scalar = Fr::one();
-            for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                auto bit = (i >> j) & 1;
-                bool b = static_cast<bool>(bit);
-                if (b) {
-                    s_vec_scalar *= round_challenges[log_poly_degree - 1 - j];
-                } else {
-                    s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                }
+        for (size_t i = 0; i < checks.size(); ++i) {
+            Fr randomness = Fr::one();
+            if (i > 0) {
+                const uint128_t r = engine->get_random_uint128();
+                randomness = Fr(uint256_t(static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64), 0, 0));
+                lhs += checks[i].C_zero * randomness;
+            }
+            const size_t size = compute_s_vec(checks[i], randomness * checks[i].a_zero, s_vec);
+            for (size_t j = 0; j < size; ++j) {
+                s_vec_sum[j] += s_vec[j];
             }
-            s_vec[i] = s_vec_scalar;
         }
+
+        // The SRS stored in the verification key is already in the pippenger point table format.
         auto srs_elements = vk->srs->get_monomial_points();
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
+        GroupElement rhs = barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
+            &s_vec_sum[0], srs_elements, poly_degree, vk->pippenger_runtime_state);
+
+        return (lhs.normalize() == rhs.normalize());
+    }
+
+  private:
+    // Minimum number of coefficients (resp. generators) folded by each thread
+    static constexpr size_t MIN_SCALARS_PER_THREAD = 1 << 10;
+    static constexpr size_t MIN_POINTS_PER_THREAD = 1 << 6;
+
+    /**
+     * @brief Writes scale·s_vec to the beginning of s_vec_out and returns the length of s_vec
+     * @details s_vec[i] = ∏_{j ∈ [k]} u_{k-1-j}^{±1}, with the exponent positive where bit j of i is set. It is
+     * built one bit at a time, doubling the length of the prefix at each step, for one multiplication per entry.
+     */
+    static size_t compute_s_vec(const DeferredCheck& check, const Fr& scale, std::vector<Fr>& s_vec_out)
+    {
+        const size_t log_poly_degree = check.round_challenges.size();
+        s_vec_out[0] = scale;
+        for (size_t j = 0; j < log_poly_degree; ++j) {
+            const size_t prefix_size = size_t(1) << j;
+            const Fr& u = check.round_challenges[log_poly_degree - 1 - j];
+            const Fr& u_inv = check.round_challenges_inv[log_poly_degree - 1 - j];
+            for (size_t i = 0; i < prefix_size; ++i) {
+                s_vec_out[prefix_size + i] = s_vec_out[i] * u;
+                s_vec_out[i] *= u_inv;
+            }
         }
-        // TODO(#473)
-        auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
+        return size_t(1) << log_poly_degree;
+    }
 
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+    /**
+     * @brief Returns (1, β, ..., β^{size-1})
+     */
+    static std::vector<Fr> compute_powers(const Fr& beta, size_t size)
+    {
+        std::vector<Fr> powers(size);
+        const size_t num_threads = barretenberg::thread_utils::calculate_num_threads_pow2(size, MIN_SCALARS_PER_THREAD);
+        const size_t chunk_size = size / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            Fr power = beta.pow(static_cast<uint64_t>(start));
+            for (size_t j = start; j < start + chunk_size; ++j) {
+                powers[j] = power;
+                power *= beta;
+            }
+        });
+        return powers;
+    }
 
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+    /**
+     * @brief Returns (Σ a[j]·β^j, Σ a[round_size + j]·β^j) over j < round_size
+     */
+    static std::pair<Fr, Fr> compute_inner_sums(const Fr* a, size_t round_size, const std::vector<Fr>& beta_powers)
+    {
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(round_size, MIN_SCALARS_PER_THREAD);
+        const size_t chunk_size = round_size / num_threads;
+        std::vector<Fr> thread_sums_lo(num_threads, Fr::zero());
+        std::vector<Fr> thread_sums_hi(num_threads, Fr::zero());
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            Fr sum_lo = Fr::zero();
+            Fr sum_hi = Fr::zero();
+            for (size_t j = start; j < start + chunk_size; ++j) {
+                sum_lo += a[j] * beta_powers[j];
+                sum_hi += a[round_size + j] * beta_powers[j];
+            }
+            thread_sums_lo[thread_idx] = sum_lo;
+            thread_sums_hi[thread_idx] = sum_hi;
+        });
+        return { std::accumulate(thread_sums_lo.begin(), thread_sums_lo.end(), Fr::zero()),
+                 std::accumulate(thread_sums_hi.begin(), thread_sums_hi.end(), Fr::zero()) };
+    }
 
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Sets a_next[j] = u·a[j] + u⁻¹·a[round_size + j] for j < round_size, and returns the inner sums of a_next
+     * for the next round (see compute_inner_sums).
+     * @details Each thread owns the indices {j, j + h, j + 2h, j + 3h} for j in its chunk of [0, h), h = round_size / 2,
+     * so a_next may alias a.
+     */
+    static std::pair<Fr, Fr> fold_coefficients(const Fr* a,
+                                               Fr* a_next,
+                                               size_t round_size,
+                                               const Fr& round_challenge,
+                                               const Fr& round_challenge_inv,
+                                               const std::vector<Fr>& beta_powers)
+    {
+        if (round_size == 1) {
+            a_next[0] = a[0] * round_challenge + a[1] * round_challenge_inv;
+            return { Fr::zero(), Fr::zero() };
+        }
+        const size_t next_round_size = round_size >> 1;
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(next_round_size, MIN_SCALARS_PER_THREAD);
+        const size_t chunk_size = next_round_size / num_threads;
+        std::vector<Fr> thread_sums_lo(num_threads, Fr::zero());
+        std::vector<Fr> thread_sums_hi(num_threads, Fr::zero());
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            Fr sum_lo = Fr::zero();
+            Fr sum_hi = Fr::zero();
+            for (size_t j = start; j < start + chunk_size; ++j) {
+                const size_t k = next_round_size + j;
+                const Fr lo = a[j] * round_challenge + a[round_size + j] * round_challenge_inv;
+                const Fr hi = a[k] * round_challenge + a[round_size + k] * round_challenge_inv;
+                a_next[j] = lo;
+                a_next[k] = hi;
+                sum_lo += lo * beta_powers[j];
+                sum_hi += hi * beta_powers[j];
+            }
+            thread_sums_lo[thread_idx] = sum_lo;
+            thread_sums_hi[thread_idx] = sum_hi;
+        });
+        return { std::accumulate(thread_sums_lo.begin(), thread_sums_lo.end(), Fr::zero()),
+                 std::accumulate(thread_sums_hi.begin(), thread_sums_hi.end(), Fr::zero()) };
+    }
+
+    /**
+     * @brief Sets G_next[j] = G[j] + u²·G[round_size + j] for j < round_size, where G is read with the given stride.
+     * @details G_next may alias G when the stride is 1: each thread reads and writes only its own chunk of indices.
+     */
+    static void fold_generators(const Commitment* G,
+                                size_t stride,
+                                Commitment* G_next,
+                                size_t round_size,
+                                const Fr& round_challenge_sqr,
+                                std::vector<GroupElement>& scratch)
+    {
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(round_size, MIN_POINTS_PER_THREAD);
+        const size_t chunk_size = round_size / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            std::vector<Commitment> G_hi(chunk_size);
+            for (size_t j = 0; j < chunk_size; ++j) {
+                G_hi[j] = G[(round_size + start + j) * stride];
+            }
+            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge_sqr);
+            GroupElement* sums = &scratch[start];
+            for (size_t j = 0; j < chunk_size; ++j) {
+                sums[j] = GroupElement(G[(start + j) * stride]) + G_hi[j];
+            }
+            GroupElement::batch_normalize(sums, chunk_size);
+            for (size_t j = 0; j < chunk_size; ++j) {
+                G_next[start + j] = Commitment(sums[j].x, sums[j].y);
+            }
+        });
     }
 };
 
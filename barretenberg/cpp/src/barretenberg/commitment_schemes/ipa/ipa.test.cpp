@@ -71,10 +71,12 @@ TEST_F(IPATest, Open)
 
     // initialize empty prover transcript
     auto prover_transcript = std::make_shared<BaseTranscript>();
+    prover_transcript->record_manifest = true;
     IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
 
     // initialize verifier transcript from proof data
     auto verifier_transcript = std::make_shared<BaseTranscript>(prover_transcript->proof_data);
+    verifier_transcript->record_manifest = true;
 
     auto result = IPA::verify(this->vk(), opening_claim, verifier_transcript);
     EXPECT_TRUE(result);
@@ -82,6 +84,53 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, OpenLargePolynomial)
+{
+    using IPA = IPA<Curve>;
+    // large enough for the folding of the first rounds to be split across threads
+    size_t n = 4096;
+    auto poly = this->random_polynomial(n);
+    auto [x, eval] = this->random_eval(poly);
+    auto commitment = this->commit(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+    auto prover_transcript = std::make_shared<BaseTranscript>();
+    IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<BaseTranscript>(prover_transcript->proof_data);
+    EXPECT_TRUE(IPA::verify(this->vk(), opening_claim, verifier_transcript));
+
+    // a proof for a different evaluation is rejected
+    const OpeningClaim<Curve> wrong_claim{ { x, eval + Fr::one() }, commitment };
+    auto wrong_verifier_transcript = std::make_shared<BaseTranscript>(prover_transcript->proof_data);
+    EXPECT_FALSE(IPA::verify(this->vk(), wrong_claim, wrong_verifier_transcript));
+}
+
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    // openings of different sizes share the MSM over the SRS
+    std::vector<typename IPA::DeferredCheck> checks;
+    for (const size_t n : std::vector<size_t>{ 128, 4, 256 }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+        auto prover_transcript = std::make_shared<BaseTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        auto verifier_transcript = std::make_shared<BaseTranscript>(prover_transcript->proof_data);
+        checks.emplace_back(IPA::reduce_verify(this->vk(), opening_claim, verifier_transcript));
+    }
+    EXPECT_TRUE(IPA::batch_verify(this->vk(), checks));
+
+    // a single invalid opening makes the batch fail
+    checks[1].a_zero += Fr::one();
+    EXPECT_FALSE(IPA::batch_verify(this->vk(), checks));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -6,6 +6,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
+#include <array>
 #include <memory>
 #include <utility>
 
@@ -58,8 +59,9 @@ template <typename Curve> class KZG {
                        const std::shared_ptr<BaseTranscript>& verifier_transcript)
     {
         auto quotient_commitment = verifier_transcript->template receive_from_prover<Commitment>("KZG:W");
-        auto lhs = claim.commitment - (GroupElement::one() * claim.opening_pair.evaluation) +
-                   (quotient_commitment * claim.opening_pair.challenge);
+        std::array<Commitment, 2> commitments = { quotient_commitment, Commitment::one() };
+        std::array<Fr, 2> scalars = { claim.opening_pair.challenge, -claim.opening_pair.evaluation };
+        auto lhs = GroupElement::batch_mul(commitments, scalars) + claim.commitment;
         auto rhs = -quotient_commitment;
 
         return vk->pairing_check(lhs, rhs);
@@ -91,9 +93,10 @@ template <typename Curve> class KZG {
             P_0 = GroupElement::batch_mul(commitments, scalars);
 
         } else {
-            P_0 = claim.commitment;
-            P_0 += quotient_commitment * claim.opening_pair.challenge;
-            P_0 -= GroupElement::one() * claim.opening_pair.evaluation;
+            std::array<Commitment, 2> commitments = { quotient_commitment, Commitment::one() };
+            std::array<Fr, 2> scalars = { claim.opening_pair.challenge, -claim.opening_pair.evaluation };
+            P_0 = GroupElement::batch_mul(commitments, scalars);
+            P_0 += claim.commitment;
         }
 
         auto P_1 = -quotient_commitment;
@@ -0,0 +1,80 @@
+#pragma once
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+
+#include <vector>
+
+namespace proof_system::honk::pcs {
+
+/**
+ * @brief Collects the (scalar, commitment) terms of a verifier-side linear combination of commitments
+ *
+ * @details Verifiers of homomorphic commitment schemes routinely form several linear combinations of commitments and
+ * then combine the results further (e.g. ZeroMorph's C_{\zeta,Z} + x * [\pi]). Evaluating each combination on its own
+ * costs one MSM per combination plus the group operations joining them. Instead, terms are appended here as they are
+ * derived, with any outer scaling folded into the scalars, and the whole combination is evaluated by a single call to
+ * `evaluate()`: one Pippenger MSM natively, or one `batch_mul` in-circuit.
+ *
+ * @note A commitment should be added at most once; if it contributes in several places, merge its scalars before
+ * adding it. The native MSM does not care, but the in-circuit batch_mul may hit an incomplete-addition edge case when
+ * the same point appears twice.
+ *
+ * @tparam Curve
+ */
+template <typename Curve> class MsmAccumulator {
+    using FF = typename Curve::ScalarField;
+    using Commitment = typename Curve::AffineElement;
+
+  public:
+    MsmAccumulator() = default;
+    explicit MsmAccumulator(size_t expected_num_terms)
+    {
+        scalars.reserve(expected_num_terms);
+        commitments.reserve(expected_num_terms);
+    }
+
+    void add_term(const Commitment& commitment, const FF& scalar)
+    {
+        commitments.emplace_back(commitment);
+        scalars.emplace_back(scalar);
+    }
+
+    size_t size() const { return scalars.size(); }
+
+    /**
+     * @brief Compute \sum_i scalars_i * commitments_i
+     */
+    Commitment evaluate() const
+    {
+        ASSERT(!scalars.empty());
+        if constexpr (Curve::is_stdlib_type) {
+            return Commitment::batch_mul(commitments, scalars);
+        } else {
+            // Points at infinity do not contribute; pippenger also needs space for the endomorphism table.
+            std::vector<FF> msm_scalars;
+            std::vector<Commitment> msm_points;
+            msm_scalars.reserve(scalars.size());
+            msm_points.reserve(2 * scalars.size());
+            for (size_t i = 0; i < scalars.size(); ++i) {
+                if (!commitments[i].is_point_at_infinity()) {
+                    msm_scalars.emplace_back(scalars[i]);
+                    msm_points.emplace_back(commitments[i]);
+                }
+            }
+            const size_t num_points = msm_points.size();
+            if (num_points == 0) {
+                return Commitment::infinity();
+            }
+            msm_points.resize(2 * num_points);
+            barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                &msm_points[0], &msm_points[0], num_points);
+            barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+            return barretenberg::scalar_multiplication::pippenger<Curve>(
+                &msm_scalars[0], &msm_points[0], num_points, state, /*handle_edge_cases=*/true);
+        }
+    }
+
+    std::vector<FF> scalars;
+    std::vector<Commitment> commitments;
+};
+
+} // namespace proof_system::honk::pcs
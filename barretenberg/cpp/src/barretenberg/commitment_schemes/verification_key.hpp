@@ -6,6 +6,7 @@
  */
 
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -65,6 +66,17 @@ template <> class VerifierCommitmentKey<curve::BN254> {
         return (result == Curve::TargetField::one());
     }
 
+    /**
+     * @brief verifies many pairing equations of the form checked by `pairing_check` at once
+     *
+     * @param points the pairs (P₀, P₁) of each equation
+     * @return ∏ e(rᵢ·P₀ⁱ,[1]₁)e(rᵢ·P₁ⁱ,[x]₂) ≡ [1]ₜ for random rᵢ
+     */
+    bool batch_pairing_check(std::span<const barretenberg::pairing::pairing_points> points)
+    {
+        return barretenberg::pairing::batch_pairing_check(points, srs->get_precomputed_g2_lines());
+    }
+
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> srs;
 };
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/commitment_schemes/msm_accumulator.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -305,6 +307,174 @@ template <typename Curve> class ZeroMorphProver_ {
         return batched_shifted_quotient;
     }
 
+    /**
+     * @brief Compute the multivariate quotients q_k of f as in compute_multilinear_quotients, packed into a single
+     * polynomial of size N
+     * @details q_k, which has size 2^k, is stored at the coefficients [2^k, 2^{k+1}) of the result; the coefficient 0 is
+     * unused. Rather than copying f at each step, the updates f[l] <- f[l] + u_k * q_k[l] are made in place, so
+     * `polynomial` is consumed and no memory is allocated beyond the result.
+     *
+     * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1}), overwritten
+     * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
+     * @return Polynomial The packed quotients q_k
+     */
+    static Polynomial compute_packed_multilinear_quotients(Polynomial& polynomial, std::span<const FF> u_challenge)
+    {
+        size_t log_N = numeric::get_msb(polynomial.size());
+        // The size of the multilinear challenge must equal the log of the polynomial size
+        ASSERT(log_N == u_challenge.size());
+
+        Polynomial quotients(polynomial.size());
+        // Compute q_k in reverse order from k = n-1, i.e. q_{n-1}, ..., q_0
+        for (size_t k = log_N - 1; k != size_t(-1); --k) {
+            const size_t size_q = size_t(1) << k;
+            const bool update_f = k > 0; // the final update would only produce the evaluation f(u)
+            barretenberg::thread_utils::parallel_for_range(size_q, [&](size_t start, size_t end) {
+                for (size_t l = start; l < end; ++l) {
+                    const FF q = polynomial[size_q + l] - polynomial[l];
+                    quotients[size_q + l] = q;
+                    if (update_f) {
+                        polynomial[l] += u_challenge[k] * q;
+                    }
+                }
+            });
+        }
+        return quotients;
+    }
+
+    /**
+     * @brief Construct the batched, lifted-degree quotient \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k from packed
+     * quotients
+     * @see compute_batched_lifted_degree_quotient, compute_packed_multilinear_quotients
+     */
+    static Polynomial compute_batched_lifted_degree_quotient(const Polynomial& packed_quotients, FF y_challenge)
+    {
+        const size_t N = packed_quotients.size();
+        const size_t log_N = numeric::get_msb(N);
+        auto result = Polynomial(N);
+
+        // Each q_k is accumulated at the offset N - d_k - 1 = N - 2^k, i.e. in the top 2^k coefficients of \hat{q}
+        auto scalar = FF(1); // y^k
+        for (size_t k = 0; k < log_N; ++k) {
+            const size_t size_q = size_t(1) << k;
+            const size_t offset = N - size_q;
+            barretenberg::thread_utils::parallel_for_range(size_q, [&](size_t start, size_t end) {
+                for (size_t idx = start; idx < end; ++idx) {
+                    result[offset + idx] += scalar * packed_quotients[size_q + idx];
+                }
+            });
+            scalar *= y_challenge;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Compute the scalars of the quotients q_k in the partially evaluated ZeroMorph identity Z_x
+     * @details Returns -x * (x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k * \Phi_{n-k}(x^{2^k})) for k = 0, ..., n-1,
+     * as in compute_partially_evaluated_zeromorph_identity_polynomial, along with \Phi_n(x). The powers x^{2^k} are
+     * computed by squaring and the n + 1 denominators x^{2^k} - 1 are inverted together.
+     */
+    static std::pair<std::vector<FF>, FF> compute_zeromorph_identity_quotient_scalars(std::span<const FF> u_challenge,
+                                                                                       FF x_challenge)
+    {
+        const size_t log_N = u_challenge.size();
+
+        // x^{2^k} for k = 0, ..., n
+        std::vector<FF> x_pows(log_N + 1);
+        x_pows[0] = x_challenge;
+        for (size_t k = 1; k <= log_N; ++k) {
+            x_pows[k] = x_pows[k - 1].sqr();
+        }
+        const FF phi_numerator = x_pows[log_N] - 1; // x^N - 1
+
+        // (x^{2^k} - 1)^{-1} for k = 0, ..., n
+        std::vector<FF> denominators(log_N + 1);
+        for (size_t k = 0; k <= log_N; ++k) {
+            denominators[k] = x_pows[k] - 1;
+        }
+        FF::batch_invert(denominators);
+
+        // \Phi_{n-k}(x^{2^k}) = (x^N - 1) / (x^{2^k} - 1)
+        std::vector<FF> scalars(log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            const FF phi_term_1 = phi_numerator * denominators[k + 1]; // \Phi_{n-k-1}(x^{2^{k+1}})
+            const FF phi_term_2 = phi_numerator * denominators[k];     // \Phi_{n-k}(x^{2^k})
+            scalars[k] = -x_challenge * (x_pows[k] * phi_term_1 - u_challenge[k] * phi_term_2);
+        }
+        return { scalars, phi_numerator * denominators[0] };
+    }
+
+    /**
+     * @brief Compute the combined evaluation and degree-check quotient pi from \hat{q} and the packed quotients
+     * @details Equivalent to compute_batched_evaluation_and_degree_check_quotient applied to the outputs of
+     * compute_partially_evaluated_degree_check_polynomial and compute_partially_evaluated_zeromorph_identity_polynomial.
+     * Since division by (X - x) is linear, pi = (\zeta_x + z * Z_x) / (X - x): \zeta_x and Z_x are not formed
+     * separately, their combination is accumulated in place into \hat{q}, with a single pass over the quotients, and
+     * the root x is factored out once.
+     *
+     * @param batched_quotient \hat{q}, consumed
+     * @param packed_quotients Quotients q_k, see compute_packed_multilinear_quotients
+     * @return Polynomial pi
+     */
+    static Polynomial compute_batched_evaluation_and_degree_check_quotient(
+        Polynomial&& batched_quotient,
+        const Polynomial& packed_quotients,
+        const Polynomial& f_batched,
+        const Polynomial& g_batched,
+        FF v_evaluation,
+        std::span<const FF> u_challenge,
+        FF x_challenge,
+        FF y_challenge,
+        FF z_challenge,
+        const std::vector<Polynomial>& concatenation_groups_batched = {})
+    {
+        const size_t N = batched_quotient.size();
+        const size_t log_N = u_challenge.size();
+        // We cannot commit to polynomials with size > N_max
+        ASSERT(N <= N_max);
+
+        Polynomial result = std::move(batched_quotient);
+
+        // \zeta_x + z * Z_x = \hat{q} + z * (x * f_batched + g_batched) - z * v * x * \Phi_n(x)
+        //                     + \sum_k (-y^k * x^{N - d_k - 1} + z * Z_k) * q_k + z * concatenation_term
+        barretenberg::thread_utils::parallel_for_range(N, [&](size_t start, size_t end) {
+            for (size_t idx = start; idx < end; ++idx) {
+                result[idx] += z_challenge * (x_challenge * f_batched[idx] + g_batched[idx]);
+            }
+        });
+
+        auto [identity_scalars, phi_n_x] = compute_zeromorph_identity_quotient_scalars(u_challenge, x_challenge);
+        result[0] -= z_challenge * v_evaluation * x_challenge * phi_n_x;
+
+        auto y_power = FF(1); // y^k
+        for (size_t k = 0; k < log_N; ++k) {
+            const size_t size_q = size_t(1) << k;
+            auto x_power = x_challenge.pow(N - size_q); // x^{N - d_k - 1}
+            const FF scalar = -y_power * x_power + z_challenge * identity_scalars[k];
+            barretenberg::thread_utils::parallel_for_range(size_q, [&](size_t start, size_t end) {
+                for (size_t idx = start; idx < end; ++idx) {
+                    result[idx] += scalar * packed_quotients[size_q + idx];
+                }
+            });
+            y_power *= y_challenge;
+        }
+
+        // See compute_partially_evaluated_zeromorph_identity_polynomial
+        if (!concatenation_groups_batched.empty()) {
+            size_t MINICIRCUIT_N = N / concatenation_groups_batched.size();
+            auto x_to_minicircuit_N = x_challenge.pow(MINICIRCUIT_N);
+            auto running_shift = z_challenge * x_challenge;
+            for (const auto& group_batched : concatenation_groups_batched) {
+                result.add_scaled(group_batched, running_shift);
+                running_shift *= x_to_minicircuit_N;
+            }
+        }
+
+        // TODO(#742): See compute_batched_evaluation_and_degree_check_quotient regarding the shift by N_max - N - 1.
+        result.factor_roots(x_challenge);
+        return result;
+    }
+
     /**
      * @brief Prove a set of multilinear evaluation claims for unshifted polynomials f_i and to-be-shifted
      * polynomials g_i
@@ -357,10 +527,13 @@ template <typename Curve> class ZeroMorphProver_ {
             batching_scalar *= rho;
         };
 
+        // Compute the full batched polynomial f = f_batched + g_batched.shifted() + concatenated_batched. This is the
+        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
+        Polynomial f_polynomial = f_batched;
+        f_polynomial += g_batched.shifted();
+
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
-        // Concatenated polynomials
-        Polynomial concatenated_batched(N);
 
         // construct concatention_groups_batched
         std::vector<Polynomial> concatenation_groups_batched;
@@ -369,7 +542,7 @@ template <typename Curve> class ZeroMorphProver_ {
         }
         // for each group
         for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
+            f_polynomial.add_scaled(concatenated_polynomials[i], batching_scalar);
             // for each element in a group
             for (size_t j = 0; j < num_chunks_per_group; ++j) {
                 concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
@@ -378,29 +551,23 @@ template <typename Curve> class ZeroMorphProver_ {
             batching_scalar *= rho;
         }
 
-        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
-        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
-
-        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1}), packed into a single polynomial. f is
+        // consumed in the process.
+        auto quotients = compute_packed_multilinear_quotients(f_polynomial, u_challenge);
+        f_polynomial = Polynomial{};
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
-            std::string label = "ZM:C_q_" + std::to_string(idx);
-            transcript->send_to_verifier(label, q_k_commitments[idx]);
+            const size_t size_q = size_t(1) << idx;
+            Commitment q_k_commitment = commitment_key->commit(std::span<const FF>{ quotients }.subspan(size_q, size_q));
+            transcript->send_to_verifier({ "ZM:C_q_", idx }, q_k_commitment);
         }
 
         // Get challenge y
         FF y_challenge = transcript->get_challenge("ZM:y");
 
         // Compute the batched, lifted-degree quotient \hat{q}
-        auto batched_quotient = compute_batched_lifted_degree_quotient(quotients, y_challenge, N);
+        auto batched_quotient = compute_batched_lifted_degree_quotient(quotients, y_challenge);
 
         // Compute and send the commitment C_q = [\hat{q}]
         auto q_commitment = commitment_key->commit(batched_quotient);
@@ -409,22 +576,18 @@ template <typename Curve> class ZeroMorphProver_ {
         // Get challenges x and z
         auto [x_challenge, z_challenge] = challenges_to_field_elements<FF>(transcript->get_challenges("ZM:x", "ZM:z"));
 
-        // Compute degree check polynomial \zeta partially evaluated at x
-        auto zeta_x =
-            compute_partially_evaluated_degree_check_polynomial(batched_quotient, quotients, y_challenge, x_challenge);
-
-        // Compute ZeroMorph identity polynomial Z partially evaluated at x
-        auto Z_x = compute_partially_evaluated_zeromorph_identity_polynomial(f_batched,
-                                                                             g_batched,
-                                                                             quotients,
-                                                                             batched_evaluation,
-                                                                             u_challenge,
-                                                                             x_challenge,
-                                                                             concatenation_groups_batched);
-
-        // Compute batched degree-check and ZM-identity quotient polynomial pi
-        auto pi_polynomial =
-            compute_batched_evaluation_and_degree_check_quotient(zeta_x, Z_x, x_challenge, z_challenge);
+        // Compute batched degree-check and ZM-identity quotient polynomial pi, from the degree check polynomial \zeta
+        // and the ZeroMorph identity polynomial Z, both partially evaluated at x
+        auto pi_polynomial = compute_batched_evaluation_and_degree_check_quotient(std::move(batched_quotient),
+                                                                                  quotients,
+                                                                                  f_batched,
+                                                                                  g_batched,
+                                                                                  batched_evaluation,
+                                                                                  u_challenge,
+                                                                                  x_challenge,
+                                                                                  y_challenge,
+                                                                                  z_challenge,
+                                                                                  concatenation_groups_batched);
 
         // Compute and send proof commitment pi
         auto pi_commitment = commitment_key->commit(pi_polynomial);
@@ -443,94 +606,79 @@ template <typename Curve> class ZeroMorphVerifier_ {
 
   public:
     /**
-     * @brief Compute commitment to partially evaluated batched lifted degree quotient identity
-     * @details Compute commitment C_{\zeta_x} = [\zeta_x]_1 using homomorphicity:
-     *
-     *  C_{\zeta_x} = [q]_1 - \sum_k y^k * x^{N - d_k - 1} * [q_k]_1
-     *
-     * @param C_q Commitment to batched lifted degree quotient
-     * @param C_q_k Commitments to quotients q_k
-     * @param y_challenge
-     * @param x_challenge
-     * @return Commitment
+     * @brief Compute the scalars multiplying [q_k]_1 in C_{\zeta_x}, i.e. -y^k * x^{N - d_k - 1}, k = 0,...,log_N - 1
      */
-    static Commitment compute_C_zeta_x(Commitment C_q, std::vector<Commitment>& C_q_k, FF y_challenge, FF x_challenge)
+    static std::vector<FF> compute_C_zeta_x_q_k_scalars(FF y_challenge, FF x_challenge, size_t log_N)
     {
-        size_t log_N = C_q_k.size();
         size_t N = 1 << log_N;
 
-        // Instantiate containers for input to batch mul
         std::vector<FF> scalars;
-        std::vector<Commitment> commitments;
-
-        // Contribution from C_q
-        if constexpr (Curve::is_stdlib_type) {
-            auto builder = x_challenge.get_context();
-            scalars.emplace_back(FF(builder, 1));
-        } else {
-            scalars.emplace_back(FF(1));
-        }
-        commitments.emplace_back(C_q);
-
-        // Contribution from C_q_k, k = 0,...,log_N
+        scalars.reserve(log_N);
         for (size_t k = 0; k < log_N; ++k) {
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             // Compute scalar y^k * x^{N - deg_k - 1}
             auto scalar = y_challenge.pow(k);
             scalar *= x_challenge.pow(N - deg_k - 1);
             scalar *= FF(-1);
-
             scalars.emplace_back(scalar);
-            commitments.emplace_back(C_q_k[k]);
         }
+        return scalars;
+    }
 
-        // Compute batch mul to get the result
-        if constexpr (Curve::is_stdlib_type) {
-            return Commitment::batch_mul(commitments, scalars);
-        } else {
-            return batch_mul_native(commitments, scalars);
+    /**
+     * @brief Compute the scalars multiplying [q_k]_1 in C_{Z_x}, k = 0,...,log_N - 1, i.e.
+     *
+     *  -x * (x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k * \Phi_{n-k}(x^{2^k}))
+     */
+    static std::vector<FF> compute_C_Z_x_q_k_scalars(FF x_challenge, const std::vector<FF>& u_challenge, size_t log_N)
+    {
+        size_t N = 1 << log_N;
+        auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
+
+        std::vector<FF> scalars;
+        scalars.reserve(log_N);
+        auto x_pow_2k = x_challenge;                 // x^{2^k}
+        auto x_pow_2kp1 = x_challenge * x_challenge; // x^{2^{k + 1}}
+        for (size_t k = 0; k < log_N; ++k) {
+
+            auto phi_term_1 = phi_numerator / (x_pow_2kp1 - 1); // \Phi_{n-k-1}(x^{2^{k + 1}})
+            auto phi_term_2 = phi_numerator / (x_pow_2k - 1);   // \Phi_{n-k}(x^{2^k})
+
+            auto scalar = x_pow_2k * phi_term_1;
+            scalar -= u_challenge[k] * phi_term_2;
+            scalar *= x_challenge;
+            scalar *= FF(-1);
+            scalars.emplace_back(scalar);
+
+            // Update powers of challenge x
+            x_pow_2k = x_pow_2kp1;
+            x_pow_2kp1 *= x_pow_2kp1;
         }
+        return scalars;
     }
 
     /**
-     * @brief Compute commitment to partially evaluated ZeroMorph identity Z
-     * @details Compute commitment C_{Z_x} = [Z_x]_1 using homomorphicity:
+     * @brief Add all terms of C_{Z_x} except those in [q_k]_1 to an MSM accumulator, each scaled by `scaling`
+     * @details The terms are
      *
-     *  C_{Z_x} = x * \sum_{i=0}^{m-1}\rho^i*[f_i] + \sum_{i=0}^{l-1}\rho^{m+i}*[g_i] - v * x * \Phi_n(x) * [1]_1
-     *              - x * \sum_k (x^{2^k}\Phi_{n-k-1}(x^{2^{k-1}}) - u_k\Phi_{n-k}(x^{2^k})) * [q_k]
+     *  x * \sum_{i=0}^{m-1}\rho^i*[f_i] + \sum_{i=0}^{l-1}\rho^{m+i}*[g_i] - v * x * \Phi_n(x) * [1]_1
      *              + concatentation_term
-     * where
      *
-     *  concatenation_term = \sum{i=0}^{o-1}\sum_{j=0}^{num_chunks_per_group}(rho^{m+l+i} * x^{j * min_N + 1}
-     *                       * concatenation_groups_commitments_{i}_{j})
-     *
-     * @note The concatenation term arises from an implementation detail in the Goblin Translator and is not part of the
-     * conventional ZM protocol
-     * @param f_commitments Commitments to unshifted polynomials [f_i]
-     * @param g_commitments Commitments to to-be-shifted polynomials [g_i]
-     * @param C_q_k Commitments to q_k
-     * @param rho
-     * @param batched_evaluation \sum_{i=0}^{m-1} \rho^i*f_i(u) + \sum_{i=0}^{l-1} \rho^{m+i}*h_i(u)
-     * @param x_challenge
-     * @param u_challenge multilinear challenge
-     * @param concatenation_groups_commitments
-     * @return Commitment
+     * The scaling is absorbed into the running power of \rho, so it costs no extra field multiplications per term.
+     * See compute_C_Z_x for the meaning of the arguments.
      */
-    static Commitment compute_C_Z_x(const std::vector<Commitment>& f_commitments,
-                                    const std::vector<Commitment>& g_commitments,
-                                    std::vector<Commitment>& C_q_k,
-                                    FF rho,
-                                    FF batched_evaluation,
-                                    FF x_challenge,
-                                    std::vector<FF> u_challenge,
-                                    const std::vector<RefVector<Commitment>>& concatenation_groups_commitments = {})
+    static void add_C_Z_x_terms(MsmAccumulator<Curve>& accumulator,
+                                const auto& f_commitments,
+                                const auto& g_commitments,
+                                FF rho,
+                                FF batched_evaluation,
+                                FF x_challenge,
+                                size_t log_N,
+                                const std::vector<RefVector<Commitment>>& concatenation_groups_commitments,
+                                FF scaling)
     {
-        size_t log_N = C_q_k.size();
         size_t N = 1 << log_N;
 
-        std::vector<FF> scalars;
-        std::vector<Commitment> commitments;
-
         // Phi_n(x) = (x^N - 1) / (x - 1)
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
         auto phi_n_x = phi_numerator / (x_challenge - 1);
@@ -538,25 +686,33 @@ template <typename Curve> class ZeroMorphVerifier_ {
         // Add contribution: -v * x * \Phi_n(x) * [1]_1
         if constexpr (Curve::is_stdlib_type) {
             auto builder = x_challenge.get_context();
-            scalars.emplace_back(FF(builder, -1) * batched_evaluation * x_challenge * phi_n_x);
-            commitments.emplace_back(Commitment::one(builder));
+            accumulator.add_term(Commitment::one(builder),
+                                 FF(builder, -1) * scaling * batched_evaluation * x_challenge * phi_n_x);
         } else {
-            scalars.emplace_back(FF(-1) * batched_evaluation * x_challenge * phi_n_x);
-            commitments.emplace_back(Commitment::one());
+            accumulator.add_term(Commitment::one(), FF(-1) * scaling * batched_evaluation * x_challenge * phi_n_x);
         }
 
         // Add contribution: x * \sum_{i=0}^{m-1} \rho^i*[f_i]
-        auto rho_pow = FF(1);
-        for (auto& commitment : f_commitments) {
-            scalars.emplace_back(x_challenge * rho_pow);
-            commitments.emplace_back(commitment);
+        const size_t f_offset = accumulator.size();
+        auto rho_pow = scaling;
+        for (size_t i = 0; i < f_commitments.size(); ++i) {
+            accumulator.add_term(f_commitments[i], x_challenge * rho_pow);
             rho_pow *= rho;
         }
 
         // Add contribution: \sum_{i=0}^{l-1} \rho^{m+i}*[g_i]
-        for (auto& commitment : g_commitments) {
-            scalars.emplace_back(rho_pow);
-            commitments.emplace_back(commitment);
+        // When the commitments come from a flavor's RefVectors, each [g_i] refers to the same object as one of the
+        // [f_i]; its scalar is then merged into that term instead of repeating the point in the MSM.
+        for (size_t j = 0; j < g_commitments.size(); ++j) {
+            size_t i = 0;
+            while (i < f_commitments.size() && &f_commitments[i] != &g_commitments[j]) {
+                ++i;
+            }
+            if (i < f_commitments.size()) {
+                accumulator.scalars[f_offset + i] += rho_pow;
+            } else {
+                accumulator.add_term(g_commitments[j], rho_pow);
+            }
             rho_pow *= rho;
         }
 
@@ -574,53 +730,100 @@ template <typename Curve> class ZeroMorphVerifier_ {
             }
             for (auto& concatenation_group_commitment : concatenation_groups_commitments) {
                 for (size_t i = 0; i < CONCATENATION_INDEX; ++i) {
-                    scalars.emplace_back(rho_pow * x_shifts[i]);
-                    commitments.emplace_back(concatenation_group_commitment[i]);
+                    accumulator.add_term(concatenation_group_commitment[i], rho_pow * x_shifts[i]);
                 }
                 rho_pow *= rho;
             }
         }
+    }
 
-        // Add contributions: scalar * [q_k],  k = 0,...,log_N, where
-        // scalar = -x * (x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k * \Phi_{n-k}(x^{2^k}))
-        auto x_pow_2k = x_challenge;                 // x^{2^k}
-        auto x_pow_2kp1 = x_challenge * x_challenge; // x^{2^{k + 1}}
-        for (size_t k = 0; k < log_N; ++k) {
-
-            auto phi_term_1 = phi_numerator / (x_pow_2kp1 - 1); // \Phi_{n-k-1}(x^{2^{k + 1}})
-            auto phi_term_2 = phi_numerator / (x_pow_2k - 1);   // \Phi_{n-k}(x^{2^k})
-
-            auto scalar = x_pow_2k * phi_term_1;
-            scalar -= u_challenge[k] * phi_term_2;
-            scalar *= x_challenge;
-            scalar *= FF(-1);
-
-            scalars.emplace_back(scalar);
-            commitments.emplace_back(C_q_k[k]);
-
-            // Update powers of challenge x
-            x_pow_2k = x_pow_2kp1;
-            x_pow_2kp1 *= x_pow_2kp1;
-        }
+    /**
+     * @brief Compute commitment to partially evaluated batched lifted degree quotient identity
+     * @details Compute commitment C_{\zeta_x} = [\zeta_x]_1 using homomorphicity:
+     *
+     *  C_{\zeta_x} = [q]_1 - \sum_k y^k * x^{N - d_k - 1} * [q_k]_1
+     *
+     * @param C_q Commitment to batched lifted degree quotient
+     * @param C_q_k Commitments to quotients q_k
+     * @param y_challenge
+     * @param x_challenge
+     * @return Commitment
+     */
+    static Commitment compute_C_zeta_x(Commitment C_q, std::vector<Commitment>& C_q_k, FF y_challenge, FF x_challenge)
+    {
+        size_t log_N = C_q_k.size();
+        MsmAccumulator<Curve> accumulator(log_N + 1);
 
+        // Contribution from C_q
         if constexpr (Curve::is_stdlib_type) {
-            return Commitment::batch_mul(commitments, scalars);
+            auto builder = x_challenge.get_context();
+            accumulator.add_term(C_q, FF(builder, 1));
         } else {
-            return batch_mul_native(commitments, scalars);
+            accumulator.add_term(C_q, FF(1));
+        }
+
+        // Contribution from C_q_k, k = 0,...,log_N
+        auto q_k_scalars = compute_C_zeta_x_q_k_scalars(y_challenge, x_challenge, log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            accumulator.add_term(C_q_k[k], q_k_scalars[k]);
         }
+
+        return accumulator.evaluate();
     }
 
     /**
-     * @brief Utility for native batch multiplication of group elements
-     * @note This is used only for native verification and is not optimized for efficiency
+     * @brief Compute commitment to partially evaluated ZeroMorph identity Z
+     * @details Compute commitment C_{Z_x} = [Z_x]_1 using homomorphicity:
+     *
+     *  C_{Z_x} = x * \sum_{i=0}^{m-1}\rho^i*[f_i] + \sum_{i=0}^{l-1}\rho^{m+i}*[g_i] - v * x * \Phi_n(x) * [1]_1
+     *              - x * \sum_k (x^{2^k}\Phi_{n-k-1}(x^{2^{k-1}}) - u_k\Phi_{n-k}(x^{2^k})) * [q_k]
+     *              + concatentation_term
+     * where
+     *
+     *  concatenation_term = \sum{i=0}^{o-1}\sum_{j=0}^{num_chunks_per_group}(rho^{m+l+i} * x^{j * min_N + 1}
+     *                       * concatenation_groups_commitments_{i}_{j})
+     *
+     * @note The concatenation term arises from an implementation detail in the Goblin Translator and is not part of the
+     * conventional ZM protocol
+     * @param f_commitments Commitments to unshifted polynomials [f_i]
+     * @param g_commitments Commitments to to-be-shifted polynomials [g_i]
+     * @param C_q_k Commitments to q_k
+     * @param rho
+     * @param batched_evaluation \sum_{i=0}^{m-1} \rho^i*f_i(u) + \sum_{i=0}^{l-1} \rho^{m+i}*h_i(u)
+     * @param x_challenge
+     * @param u_challenge multilinear challenge
+     * @param concatenation_groups_commitments
+     * @return Commitment
      */
-    static Commitment batch_mul_native(const std::vector<Commitment>& points, const std::vector<FF>& scalars)
+    static Commitment compute_C_Z_x(const std::vector<Commitment>& f_commitments,
+                                    const std::vector<Commitment>& g_commitments,
+                                    std::vector<Commitment>& C_q_k,
+                                    FF rho,
+                                    FF batched_evaluation,
+                                    FF x_challenge,
+                                    std::vector<FF> u_challenge,
+                                    const std::vector<RefVector<Commitment>>& concatenation_groups_commitments = {})
     {
-        auto result = points[0] * scalars[0];
-        for (size_t idx = 1; idx < scalars.size(); ++idx) {
-            result = result + points[idx] * scalars[idx];
+        size_t log_N = C_q_k.size();
+        MsmAccumulator<Curve> accumulator;
+
+        add_C_Z_x_terms(accumulator,
+                        f_commitments,
+                        g_commitments,
+                        rho,
+                        batched_evaluation,
+                        x_challenge,
+                        log_N,
+                        concatenation_groups_commitments,
+                        FF(1));
+
+        // Add contributions: scalar * [q_k],  k = 0,...,log_N
+        auto q_k_scalars = compute_C_Z_x_q_k_scalars(x_challenge, u_challenge, log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            accumulator.add_term(C_q_k[k], q_k_scalars[k]);
         }
-        return result;
+
+        return accumulator.evaluate();
     }
 
     /**
@@ -666,7 +869,7 @@ template <typename Curve> class ZeroMorphVerifier_ {
         std::vector<Commitment> C_q_k;
         C_q_k.reserve(log_N);
         for (size_t i = 0; i < log_N; ++i) {
-            C_q_k.emplace_back(transcript->template receive_from_prover<Commitment>("ZM:C_q_" + std::to_string(i)));
+            C_q_k.emplace_back(transcript->template receive_from_prover<Commitment>({ "ZM:C_q_", i }));
         }
 
         // Challenge y
@@ -678,22 +881,6 @@ template <typename Curve> class ZeroMorphVerifier_ {
         // Challenges x, z
         auto [x_challenge, z_challenge] = challenges_to_field_elements<FF>(transcript->get_challenges("ZM:x", "ZM:z"));
 
-        // Compute commitment C_{\zeta_x}
-        auto C_zeta_x = compute_C_zeta_x(C_q, C_q_k, y_challenge, x_challenge);
-
-        // Compute commitment C_{Z_x}
-        Commitment C_Z_x = compute_C_Z_x(unshifted_commitments,
-                                         to_be_shifted_commitments,
-                                         C_q_k,
-                                         rho,
-                                         batched_evaluation,
-                                         x_challenge,
-                                         multivariate_challenge,
-                                         concatenation_group_commitments);
-
-        // Compute commitment C_{\zeta,Z}
-        auto C_zeta_Z = C_zeta_x + C_Z_x * z_challenge;
-
         // Receive proof commitment \pi
         auto C_pi = transcript->template receive_from_prover<Commitment>("ZM:PI");
 
@@ -702,7 +889,35 @@ template <typename Curve> class ZeroMorphVerifier_ {
         // e(C_{\zeta,Z}, [1]_2) = e(pi, [X - x]_2). This can be rearranged (e.g. see the plonk paper) as
         // e(C_{\zeta,Z} - x*pi, [1]_2) * e(-pi, [X]_2) = 1, or
         // e(P_0, [1]_2) * e(P_1, [X]_2) = 1
-        auto P0 = C_zeta_Z + C_pi * x_challenge;
+        //
+        // P_0 = C_{\zeta_x} + z * C_{Z_x} + x * [\pi] is evaluated as a single MSM. Each [q_k] appears in both
+        // C_{\zeta_x} and C_{Z_x}, so its two scalars are merged into one term. The terms of C_{Z_x} come first, in the
+        // order in which they were previously batched on their own, so that the grouping of points into lookup tables
+        // by the in-circuit batch_mul stays the same for them.
+        MsmAccumulator<Curve> accumulator(log_N + unshifted_commitments.size() + to_be_shifted_commitments.size() + 3);
+        add_C_Z_x_terms(accumulator,
+                        unshifted_commitments,
+                        to_be_shifted_commitments,
+                        rho,
+                        batched_evaluation,
+                        x_challenge,
+                        log_N,
+                        concatenation_group_commitments,
+                        z_challenge);
+        auto zeta_x_q_k_scalars = compute_C_zeta_x_q_k_scalars(y_challenge, x_challenge, log_N);
+        auto Z_x_q_k_scalars = compute_C_Z_x_q_k_scalars(x_challenge, multivariate_challenge, log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            accumulator.add_term(C_q_k[k], zeta_x_q_k_scalars[k] + z_challenge * Z_x_q_k_scalars[k]);
+        }
+        if constexpr (Curve::is_stdlib_type) {
+            auto builder = x_challenge.get_context();
+            accumulator.add_term(C_q, FF(builder, 1));
+        } else {
+            accumulator.add_term(C_q, FF(1));
+        }
+        accumulator.add_term(C_pi, x_challenge);
+
+        auto P0 = accumulator.evaluate();
         auto P1 = -C_pi;
 
         return { P0, P1 };
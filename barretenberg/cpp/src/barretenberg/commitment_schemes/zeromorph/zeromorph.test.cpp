@@ -496,6 +496,95 @@ TYPED_TEST(ZeroMorphTest, PartiallyEvaluatedQuotientZ)
     EXPECT_EQ(Z_x, Z_x_expected);
 }
 
+/**
+ * @brief Test that the packed quotients and the combined quotient pi used by the prover agree with the step-by-step
+ * construction
+ *
+ */
+TYPED_TEST(ZeroMorphTest, PackedQuotientsMatchStepByStep)
+{
+    // Define some useful type aliases
+    using ZeroMorphProver = ZeroMorphProver_<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = barretenberg::Polynomial<Fr>;
+
+    const size_t N = 64;
+    size_t log_N = numeric::get_msb(N);
+
+    Polynomial f_batched = this->random_polynomial(N);
+    Polynomial g_batched = this->random_polynomial(N);
+    g_batched[0] = 0;
+    std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
+    Polynomial f_polynomial = f_batched;
+    f_polynomial += g_batched.shifted();
+    Fr v_evaluation = f_polynomial.evaluate_mle(u_challenge);
+
+    auto quotients = ZeroMorphProver::compute_multilinear_quotients(f_polynomial, u_challenge);
+    auto packed_quotients = ZeroMorphProver::compute_packed_multilinear_quotients(f_polynomial, u_challenge);
+    for (size_t k = 0; k < log_N; ++k) {
+        for (size_t idx = 0; idx < (size_t(1) << k); ++idx) {
+            EXPECT_EQ(packed_quotients[(size_t(1) << k) + idx], quotients[k][idx]);
+        }
+    }
+
+    auto y_challenge = Fr::random_element();
+    auto x_challenge = Fr::random_element();
+    auto z_challenge = Fr::random_element();
+
+    auto batched_quotient = ZeroMorphProver::compute_batched_lifted_degree_quotient(quotients, y_challenge, N);
+    auto packed_batched_quotient = ZeroMorphProver::compute_batched_lifted_degree_quotient(packed_quotients, y_challenge);
+    EXPECT_EQ(packed_batched_quotient, batched_quotient);
+
+    auto zeta_x = ZeroMorphProver::compute_partially_evaluated_degree_check_polynomial(
+        batched_quotient, quotients, y_challenge, x_challenge);
+    auto Z_x = ZeroMorphProver::compute_partially_evaluated_zeromorph_identity_polynomial(
+        f_batched, g_batched, quotients, v_evaluation, u_challenge, x_challenge);
+    auto pi_expected =
+        ZeroMorphProver::compute_batched_evaluation_and_degree_check_quotient(zeta_x, Z_x, x_challenge, z_challenge);
+
+    auto pi = ZeroMorphProver::compute_batched_evaluation_and_degree_check_quotient(std::move(packed_batched_quotient),
+                                                                                     packed_quotients,
+                                                                                     f_batched,
+                                                                                     g_batched,
+                                                                                     v_evaluation,
+                                                                                     u_challenge,
+                                                                                     x_challenge,
+                                                                                     y_challenge,
+                                                                                     z_challenge);
+    EXPECT_EQ(pi, pi_expected);
+}
+
+/**
+ * @brief Test that the MSM accumulator used by the verifier agrees with a naive linear combination, including when the
+ * terms contain a repeated point and the point at infinity
+ *
+ */
+TYPED_TEST(ZeroMorphTest, MsmAccumulatorMatchesNaive)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Commitment = typename TypeParam::AffineElement;
+    using GroupElement = typename TypeParam::Element;
+
+    const size_t num_terms = 40;
+    MsmAccumulator<TypeParam> accumulator(num_terms);
+    GroupElement expected = GroupElement::infinity();
+    for (size_t i = 0; i < num_terms; ++i) {
+        Commitment point = GroupElement::random_element();
+        if (i == 7) {
+            point = accumulator.commitments[3];
+        }
+        if (i == 11) {
+            point = Commitment::infinity();
+        }
+        Fr scalar = this->random_element();
+        accumulator.add_term(point, scalar);
+        if (!point.is_point_at_infinity()) {
+            expected += GroupElement(point) * scalar;
+        }
+    }
+    EXPECT_EQ(accumulator.evaluate(), Commitment(expected));
+}
+
 /**
  * @brief Test full Prover/Verifier protocol for proving single multilinear evaluation
  *
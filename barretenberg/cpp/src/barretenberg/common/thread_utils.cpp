@@ -37,4 +37,25 @@ size_t calculate_num_threads_pow2(size_t num_iterations, size_t min_iterations_p
     return num_threads;
 }
 
+/**
+ * @brief splits [0, num_iterations) into contiguous ranges, one per thread, and calls func(start, end) on each
+ * @details The number of threads is given by `calculate_num_threads`; the last thread also takes the leftovers.
+ * @param num_iterations
+ * @param func
+ * @param min_iterations_per_thread
+ */
+void parallel_for_range(size_t num_iterations,
+                        const std::function<void(size_t, size_t)>& func,
+                        size_t min_iterations_per_thread)
+{
+    size_t num_threads = calculate_num_threads(num_iterations, min_iterations_per_thread);
+    size_t range_per_thread = num_iterations / num_threads;
+    size_t leftovers = num_iterations - (range_per_thread * num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        size_t start = j * range_per_thread;
+        size_t end = (j == num_threads - 1) ? start + range_per_thread + leftovers : start + range_per_thread;
+        func(start, end);
+    });
+}
+
 } // namespace barretenberg::thread_utils
\ No newline at end of file
@@ -1,3 +1,4 @@
+#pragma once
 #include "thread.hpp"
 
 namespace barretenberg::thread_utils {
@@ -26,4 +27,15 @@ size_t calculate_num_threads(size_t num_iterations, size_t min_iterations_per_th
 size_t calculate_num_threads_pow2(size_t num_iterations,
                                   size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD);
 
+/**
+ * @brief splits [0, num_iterations) into contiguous ranges, one per thread, and calls func(start, end) on each
+ * @details The number of threads is given by `calculate_num_threads`; the last thread also takes the leftovers.
+ * @param num_iterations
+ * @param func
+ * @param min_iterations_per_thread
+ */
+void parallel_for_range(size_t num_iterations,
+                        const std::function<void(size_t, size_t)>& func,
+                        size_t min_iterations_per_thread = DEFAULT_MIN_ITERS_PER_THREAD);
+
 } // namespace barretenberg::thread_utils
\ No newline at end of file
@@ -25,5 +25,58 @@ void native_poseidon2_commitment_bench(State& state) noexcept
 }
 BENCHMARK(native_poseidon2_commitment_bench)->Arg(10)->Arg(1000)->Arg(10000);
 
+using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+std::vector<grumpkin::fq> random_inputs(const size_t count)
+{
+    std::vector<grumpkin::fq> inputs(count);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    return inputs;
+}
+
+// Hashes `count` pairs one at a time, as a Merkle tree layer would be hashed with `Poseidon2::hash`.
+void native_poseidon2_hash_pairs_sequential_bench(State& state) noexcept
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    auto left = random_inputs(count);
+    auto right = random_inputs(count);
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            std::array<grumpkin::fq, 2> input{ left[i], right[i] };
+            DoNotOptimize(Poseidon2::hash(input));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(native_poseidon2_hash_pairs_sequential_bench)->Arg(1 << 10)->Arg(1 << 16)->Unit(kMillisecond);
+
+void native_poseidon2_hash_pairs_batch_bench(State& state) noexcept
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    auto left = random_inputs(count);
+    auto right = random_inputs(count);
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash_pairs(left, right));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(native_poseidon2_hash_pairs_batch_bench)->Arg(1 << 10)->Arg(1 << 16)->Unit(kMillisecond);
+
+void native_poseidon2_hash_batch_bench(State& state) noexcept
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<grumpkin::fq>> inputs(count);
+    for (auto& input : inputs) {
+        input = random_inputs(8);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(Poseidon2::hash_batch(inputs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(native_poseidon2_hash_batch_bench)->Arg(1 << 10)->Arg(1 << 16)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
 // } // namespace crypto
\ No newline at end of file
@@ -4,13 +4,112 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+
+#include <map>
+#include <vector>
+
 namespace crypto {
 
 template <typename Params> class Poseidon2 {
   public:
     using FF = typename Params::FF;
+    using Permutation = Poseidon2Permutation<Params>;
 
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
     static FF hash(std::span<FF> input) { return Sponge::hash_fixed_length(input); }
+
+    // Number of sponge states that the batch hashing functions permute together.
+    static constexpr size_t BATCH_LANES = 4;
+    static constexpr size_t MIN_HASHES_PER_THREAD = 64;
+
+    /**
+     * @brief Hashes each of the `inputs` independently, with the same result as calling `hash` on each of them.
+     * @details Inputs are grouped by length and split between threads. Each thread absorbs BATCH_LANES inputs at a time
+     * into separate sponge states and permutes them together with `Permutation::permutation_batch`.
+     */
+    static std::vector<FF> hash_batch(std::span<const std::vector<FF>> inputs)
+    {
+        std::vector<FF> outputs(inputs.size());
+        std::map<size_t, std::vector<size_t>> indices_by_length;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            indices_by_length[inputs[i].size()].push_back(i);
+        }
+        for (auto const& [length, indices] : indices_by_length) {
+            hash_fixed_length_batch(
+                indices.size(),
+                length,
+                [&](size_t i, size_t j) -> FF const& { return inputs[indices[i]][j]; },
+                [&](size_t i, FF const& result) { outputs[indices[i]] = result; });
+        }
+        return outputs;
+    }
+
+    /**
+     * @brief Computes hash({ left[i], right[i] }) for every i, e.g. to hash a layer of a Merkle tree.
+     */
+    static std::vector<FF> hash_pairs(std::span<const FF> left, std::span<const FF> right)
+    {
+        ASSERT(left.size() == right.size());
+        std::vector<FF> outputs(left.size());
+        hash_fixed_length_batch(
+            left.size(),
+            2,
+            [&](size_t i, size_t j) -> FF const& { return j == 0 ? left[i] : right[i]; },
+            [&](size_t i, FF const& result) { outputs[i] = result; });
+        return outputs;
+    }
+
+  private:
+    static constexpr size_t rate = Params::t - 1;
+
+    /**
+     * @brief Fixed-length sponge hash of `num_inputs` inputs of `length` elements each.
+     *
+     * @param input (i, j) -> element j of input i
+     * @param output (i, result) stores the hash of input i
+     */
+    template <typename InputFn, typename OutputFn>
+    static void hash_fixed_length_batch(size_t num_inputs,
+                                        size_t length,
+                                        InputFn const& input,
+                                        OutputFn const& output)
+    {
+        // Matches the domain separator of `Sponge::hash_fixed_length` with a single output element.
+        const FF iv = FF(static_cast<uint256_t>(length) << 64);
+
+        const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(num_inputs, MIN_HASHES_PER_THREAD);
+        const size_t inputs_per_thread = (num_inputs + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * inputs_per_thread;
+            const size_t end = std::min(start + inputs_per_thread, num_inputs);
+            for (size_t i = start; i < end; i += BATCH_LANES) {
+                const size_t num_lanes = std::min(BATCH_LANES, end - i);
+
+                std::array<typename Permutation::State, BATCH_LANES> states;
+                for (auto& state : states) {
+                    state.fill(FF::zero());
+                    state[rate] = iv;
+                }
+                // Unused lanes permute the initial state; their results are discarded.
+                size_t absorbed = 0;
+                do {
+                    for (size_t lane = 0; lane < num_lanes; ++lane) {
+                        for (size_t k = 0; k < rate && absorbed + k < length; ++k) {
+                            states[lane][k] += input(i + lane, absorbed + k);
+                        }
+                    }
+                    Permutation::permutation_batch(states);
+                    absorbed += rate;
+                } while (absorbed < length);
+
+                for (size_t lane = 0; lane < num_lanes; ++lane) {
+                    output(i + lane, states[lane][0]);
+                }
+            }
+        });
+    }
 };
 } // namespace crypto
\ No newline at end of file
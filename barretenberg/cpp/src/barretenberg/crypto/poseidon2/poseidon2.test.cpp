@@ -46,4 +46,45 @@ TEST(Poseidon2, ConsistencyCheck)
 
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2, HashBatchMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Inputs of mixed lengths, including an empty one and lengths on both sides of a multiple of the rate.
+    std::vector<std::vector<barretenberg::fr>> inputs(37);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i].resize(i % 8);
+        for (auto& element : inputs[i]) {
+            element = barretenberg::fr::random_element(&engine);
+        }
+    }
+
+    auto results = Poseidon2::hash_batch(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], Poseidon2::hash(inputs[i]));
+    }
+}
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::vector<barretenberg::fr> left(131);
+    std::vector<barretenberg::fr> right(131);
+    for (size_t i = 0; i < left.size(); ++i) {
+        left[i] = barretenberg::fr::random_element(&engine);
+        right[i] = barretenberg::fr::random_element(&engine);
+    }
+
+    auto results = Poseidon2::hash_pairs(left, right);
+
+    ASSERT_EQ(results.size(), left.size());
+    for (size_t i = 0; i < left.size(); ++i) {
+        std::vector<barretenberg::fr> input{ left[i], right[i] };
+        EXPECT_EQ(results[i], Poseidon2::hash(input));
+    }
+}
 } // namespace poseidon2_tests
\ No newline at end of file
@@ -152,5 +152,59 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to N independent states in place.
+     * @details Each step of the permutation is applied to all N states before moving on to the next one, so the
+     * field multiplications of different states do not depend on each other and the CPU can overlap them. This
+     * matters most in the partial rounds, where every round of a single state waits on the s-box of the previous one.
+     *
+     * @tparam N number of states
+     */
+    template <size_t N> static constexpr void permutation_batch(std::array<State, N>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            std::array<FF, N> squares;
+            for (size_t j = 0; j < N; ++j) {
+                states[j][0] += round_constants[i][0];
+                squares[j] = states[j][0].sqr();
+            }
+            for (size_t j = 0; j < N; ++j) {
+                squares[j].self_sqr();
+            }
+            for (size_t j = 0; j < N; ++j) {
+                states[j][0] *= squares[j];
+            }
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace crypto
\ No newline at end of file
@@ -21,6 +21,28 @@ TEST(Poseidon2Permutation, TestVectors)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2Permutation, BatchMatchesSingle)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::array<Permutation::State, 3> states;
+    states[0] = crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_INPUT;
+    for (size_t i = 1; i < states.size(); ++i) {
+        for (auto& element : states[i]) {
+            element = barretenberg::fr::random_element(&engine);
+        }
+    }
+    auto expected = states;
+    for (auto& state : expected) {
+        state = Permutation::permutation(state);
+    }
+
+    Permutation::permutation_batch(states);
+
+    EXPECT_EQ(states, expected);
+    EXPECT_EQ(states[0], crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_OUTPUT);
+}
+
 TEST(Poseidon2Permutation, BasicTests)
 {
 
@@ -150,6 +150,46 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
     }
 }
 
+/**
+ * @brief Verifies a batch of proofs of this circuit, sharing a single final exponentiation between them.
+ * @details All proofs must have been created with the same `is_recursive` setting. The result is true only if every
+ * proof is valid; a failing batch does not tell which proof is invalid.
+ */
+bool AcirComposer::batch_verify_proofs(std::vector<std::vector<uint8_t>> const& proofs, bool is_recursive)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+
+    acir_format::Composer composer(proving_key_, verification_key_);
+
+    if (!verification_key_) {
+        vinfo("computing verification key...");
+        verification_key_ = composer.compute_verification_key(builder_);
+        vinfo("done.");
+    }
+
+    // Same hack as verify_proof. Proofs of the same circuit have the same number of public inputs.
+    builder_.public_inputs.resize((proofs[0].size() - 2144) / 32);
+
+    std::vector<proof_system::plonk::proof> plonk_proofs;
+    plonk_proofs.reserve(proofs.size());
+    for (auto const& proof : proofs) {
+        if (proof.size() != proofs[0].size()) {
+            return false;
+        }
+        plonk_proofs.push_back({ proof });
+    }
+
+    if (is_recursive) {
+        auto verifier = composer.create_verifier(builder_);
+        return verifier.batch_verify_proofs(plonk_proofs);
+    } else {
+        auto verifier = composer.create_ultra_with_keccak_verifier(builder_);
+        return verifier.batch_verify_proofs(plonk_proofs);
+    }
+}
+
 bool AcirComposer::verify_goblin_proof(std::vector<uint8_t> const& proof)
 {
     return goblin.verify_proof({ proof });
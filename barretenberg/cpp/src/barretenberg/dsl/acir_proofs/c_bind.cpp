@@ -114,6 +114,16 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
     *result = acir_composer->verify_proof(proof, *is_recursive);
 }
 
+WASM_EXPORT void acir_batch_verify_proofs(in_ptr acir_composer_ptr,
+                                          uint8_t const* proofs_buf,
+                                          bool const* is_recursive,
+                                          bool* result)
+{
+    auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
+    auto proofs = from_buffer<std::vector<std::vector<uint8_t>>>(proofs_buf);
+    *result = acir_composer->batch_verify_proofs(proofs, *is_recursive);
+}
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out)
 {
     auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
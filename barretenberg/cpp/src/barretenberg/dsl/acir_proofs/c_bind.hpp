@@ -50,6 +50,14 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
                                    bool const* is_recursive,
                                    bool* result);
 
+/**
+ * @brief Verifies a serialized vector of proofs at once. Returns true only if all of them are valid.
+ */
+WASM_EXPORT void acir_batch_verify_proofs(in_ptr acir_composer_ptr,
+                                          uint8_t const* proofs_buf,
+                                          bool const* is_recursive,
+                                          bool* result);
+
 WASM_EXPORT void acir_verify_goblin_proof(in_ptr acir_composer_ptr, uint8_t const* proof_buf, bool* result);
 
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out);
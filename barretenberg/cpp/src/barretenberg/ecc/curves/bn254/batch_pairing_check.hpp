@@ -0,0 +1,83 @@
+#pragma once
+
+#include "./pairing.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace barretenberg::pairing {
+
+/**
+ * @brief The two G1 points of a KZG-style pairing equation e(P₀, [1]₂)·e(P₁, [x]₂) ≡ 1.
+ */
+using pairing_points = std::array<g1::affine_element, 2>;
+
+/**
+ * @brief Checks a batch of pairing equations e(P₀ⁱ, [1]₂)·e(P₁ⁱ, [x]₂) ≡ 1 with a single final exponentiation.
+ *
+ * @details All equations share the same G2 points, so they can be folded with random scalars rᵢ into
+ * e(Σ rᵢ·P₀ⁱ, [1]₂)·e(Σ rᵢ·P₁ⁱ, [x]₂) ≡ 1. The two sums are computed with one Pippenger MSM each, after which a
+ * 2-pair Miller loop and one final exponentiation remain, instead of one of each per equation.
+ *
+ * The first scalar is 1 and the others are 128-bit, which is plenty for the soundness of the combination (a cheating
+ * batch passes with probability ≤ 2⁻¹²⁸) and halves the length of the MSM scalars.
+ * If the batch fails, nothing is learnt about which equation is invalid.
+ *
+ * @param points the pairing points of each equation
+ * @param lines the precomputed Miller lines of [1]₂ and [x]₂, as returned by `VerifierCrs::get_precomputed_g2_lines`
+ * @param engine source of the random scalars; defaults to the secure engine
+ * @return true if every equation holds (with overwhelming probability)
+ */
+inline bool batch_pairing_check(std::span<const pairing_points> points,
+                                const miller_lines* lines,
+                                numeric::random::Engine* engine = nullptr)
+{
+    if (points.empty()) {
+        return true;
+    }
+    if (engine == nullptr) {
+        engine = &numeric::random::get_engine();
+    }
+
+    std::vector<fr> randomness(points.size());
+    randomness[0] = fr::one();
+    for (size_t i = 1; i < points.size(); ++i) {
+        const uint128_t r = engine->get_random_uint128();
+        randomness[i] = fr(uint256_t(static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64), 0, 0));
+    }
+
+    g1::element accumulated[2];
+    for (size_t k = 0; k < 2; ++k) {
+        // Points at infinity do not contribute; pippenger also needs space for the endomorphism table.
+        std::vector<fr> scalars;
+        std::vector<g1::affine_element> elements;
+        scalars.reserve(points.size());
+        elements.reserve(points.size() * 2);
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (!points[i][k].is_point_at_infinity()) {
+                scalars.emplace_back(randomness[i]);
+                elements.emplace_back(points[i][k]);
+            }
+        }
+        const size_t num_elements = elements.size();
+        if (num_elements == 0) {
+            accumulated[k] = g1::element::infinity();
+            continue;
+        }
+        elements.resize(num_elements * 2);
+        scalar_multiplication::generate_pippenger_point_table<curve::BN254>(&elements[0], &elements[0], num_elements);
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+        accumulated[k] =
+            scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
+    }
+
+    g1::affine_element P_affine[2]{ accumulated[0], accumulated[1] };
+
+    fq12 result = reduced_ate_pairing_batch_precomputed(P_affine, lines, 2);
+    return (result == fq12::one());
+}
+
+} // namespace barretenberg::pairing
@@ -417,6 +417,48 @@ TEST(fq12, FromMontgomeryForm)
     EXPECT_EQ(result, expected);
 }
 
+namespace {
+// Maps a random element into the cyclotomic subgroup, as the easy part of the final exponentiation does
+fq12 random_cyclotomic_element()
+{
+    fq12 a = fq12::random_element();
+    fq12 b = a.unitary_inverse() * a.invert();
+    return b * b.frobenius_map_two();
+}
+} // namespace
+
+TEST(fq12, CyclotomicSquared)
+{
+    fq12 a = random_cyclotomic_element();
+    EXPECT_EQ(a.cyclotomic_squared(), a.sqr());
+    EXPECT_EQ(fq12::one().cyclotomic_squared(), fq12::one());
+}
+
+TEST(fq12, CyclotomicSquaredCompressed)
+{
+    constexpr size_t num_squarings = 8;
+    fq12 a = random_cyclotomic_element();
+
+    std::array<fq12, num_squarings + 1> compressed;
+    std::array<fq12, num_squarings + 1> expected;
+    fq12 c = a;
+    fq12 e = a;
+    for (size_t i = 0; i < num_squarings; ++i) {
+        c = c.cyclotomic_squared_compressed();
+        e = e.cyclotomic_squared();
+        compressed[i] = c;
+        expected[i] = e;
+    }
+    // The identity has g2 = g3 = 0 and must decompress to itself
+    compressed[num_squarings] = fq12::one().cyclotomic_squared_compressed();
+    expected[num_squarings] = fq12::one();
+
+    fq12::batch_decompress_karabina(compressed);
+    for (size_t i = 0; i < compressed.size(); ++i) {
+        EXPECT_EQ(compressed[i], expected[i]);
+    }
+}
+
 TEST(fq12, MulSqrConsistency)
 {
     fq12 a = fq12::random_element();
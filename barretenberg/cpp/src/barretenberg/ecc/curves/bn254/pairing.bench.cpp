@@ -0,0 +1,68 @@
+#include "pairing.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+
+void fq12_cyclotomic_squared_bench(State& state) noexcept
+{
+    fq12 a = pairing::final_exponentiation_easy_part(fq12::random_element());
+    for (auto _ : state) {
+        a = a.cyclotomic_squared();
+        DoNotOptimize(a);
+    }
+}
+BENCHMARK(fq12_cyclotomic_squared_bench);
+
+void fq12_sqr_bench(State& state) noexcept
+{
+    fq12 a = fq12::random_element();
+    for (auto _ : state) {
+        a = a.sqr();
+        DoNotOptimize(a);
+    }
+}
+BENCHMARK(fq12_sqr_bench);
+
+void final_exponentiation_bench(State& state) noexcept
+{
+    fq12 a = fq12::random_element();
+    for (auto _ : state) {
+        fq12 result = pairing::final_exponentiation_easy_part(a);
+        result = pairing::final_exponentiation_tricky_part(result);
+        DoNotOptimize(result);
+    }
+}
+BENCHMARK(final_exponentiation_bench)->Unit(kMicrosecond);
+
+void miller_loop_batch_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<g1::element> points(num_pairs);
+    std::vector<pairing::miller_lines> lines(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        points[i] = g1::element(g1::affine_element(g1::element::random_element()));
+        pairing::precompute_miller_lines(g2::element::random_element(), lines[i]);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(pairing::miller_loop_batch(&points[0], &lines[0], num_pairs));
+    }
+}
+BENCHMARK(miller_loop_batch_bench)->Arg(1)->Arg(2)->Arg(4)->Unit(kMicrosecond);
+
+// The final pairing check of a Plonk or Honk verifier: two pairs against precomputed lines
+void reduced_ate_pairing_batch_precomputed_bench(State& state) noexcept
+{
+    std::array<g1::affine_element, 2> points{ g1::element::random_element(), g1::element::random_element() };
+    std::vector<pairing::miller_lines> lines(2);
+    pairing::precompute_miller_lines(g2::one, lines[0]);
+    pairing::precompute_miller_lines(g2::element::random_element(), lines[1]);
+    for (auto _ : state) {
+        DoNotOptimize(pairing::reduced_ate_pairing_batch_precomputed(&points[0], &lines[0], 2));
+    }
+}
+BENCHMARK(reduced_ate_pairing_batch_precomputed_bench)->Unit(kMicrosecond);
+
+} // namespace
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <random>
 
 #include "./fq12.hpp"
@@ -24,6 +25,19 @@ constexpr std::array<bool, neg_z_loop_length> neg_z_loop_bits{
     false, false, true,  false, false, true,  true,  true,  true, true,  false, false, false, true
 };
 
+// The BN parameter z (a.k.a. x or u). neg_z_loop_bits are its bits below the leading one.
+constexpr uint64_t neg_z = []() {
+    uint64_t result = 1;
+    for (bool bit : neg_z_loop_bits) {
+        result = (result << 1) | static_cast<uint64_t>(bit);
+    }
+    return result;
+}();
+static_assert(neg_z == 4965661367192848881ULL);
+constexpr size_t neg_z_bit_length = neg_z_loop_length + 1;
+constexpr size_t neg_z_num_set_bits = static_cast<size_t>(std::popcount(neg_z));
+static_assert((neg_z & 1) == 1);
+
 struct miller_lines {
     std::array<fq12::ell_coeffs, precomputed_coefficients_length> lines;
 };
@@ -43,6 +43,23 @@ TEST(pairing, ReducedAtePairingCheckAgainstConstants)
     EXPECT_EQ(result, expected);
 }
 
+TEST(pairing, FinalExponentiationExpByNegZ)
+{
+    fq12 a = pairing::final_exponentiation_easy_part(fq12::random_element());
+
+    // Plain square-and-multiply, with generic squaring
+    fq12 expected = a;
+    for (bool bit : pairing::neg_z_loop_bits) {
+        expected = expected.sqr();
+        if (bit) {
+            expected *= a;
+        }
+    }
+    expected = expected.unitary_inverse();
+
+    EXPECT_EQ(pairing::final_exponentiation_exp_by_neg_z(a), expected);
+}
+
 TEST(pairing, ReducedAtePairingConsistencyCheck)
 {
     g1::affine_element P = g1::element::random_element();
@@ -127,8 +127,10 @@ constexpr fq12 miller_loop(g1::element& P, miller_lines& lines)
     size_t it = 0;
     fq12::ell_coeffs work_line;
 
-    for (unsigned char loop_bit : loop_bits) {
-        work_scalar = work_scalar.sqr();
+    for (size_t i = 0; i < loop_length; ++i) {
+        if (i > 0) {
+            work_scalar = work_scalar.sqr();
+        }
 
         work_line.o = lines.lines[it].o;
         work_line.vw = lines.lines[it].vw.mul_by_fq(P.y);
@@ -136,7 +138,7 @@ constexpr fq12 miller_loop(g1::element& P, miller_lines& lines)
         work_scalar.self_sparse_mul(work_line);
         ++it;
 
-        if (loop_bit != 0) {
+        if (loop_bits[i] != 0) {
             work_line.o = lines.lines[it].o;
             work_line.vw = lines.lines[it].vw.mul_by_fq(P.y);
             work_line.vv = lines.lines[it].vv.mul_by_fq(P.x);
@@ -165,8 +167,11 @@ constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines*
     size_t it = 0;
     fq12::ell_coeffs work_line;
 
-    for (unsigned char loop_bit : loop_bits) {
-        work_scalar = work_scalar.sqr();
+    for (size_t i = 0; i < loop_length; ++i) {
+        // work_scalar is one before the first line is multiplied in, so there is nothing to square
+        if (i > 0) {
+            work_scalar = work_scalar.sqr();
+        }
         for (size_t j = 0; j < num_pairs; ++j) {
             work_line.o = lines[j].lines[it].o;
             work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
@@ -174,7 +179,7 @@ constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines*
             work_scalar.self_sparse_mul(work_line);
         }
         ++it;
-        if (loop_bit != 0) {
+        if (loop_bits[i] != 0) {
             for (size_t j = 0; j < num_pairs; ++j) {
                 work_line.o = lines[j].lines[it].o;
                 work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
@@ -211,14 +216,24 @@ constexpr fq12 final_exponentiation_easy_part(const fq12& elt)
 
 constexpr fq12 final_exponentiation_exp_by_neg_z(const fq12& elt)
 {
-    fq12 r = elt;
-
-    for (bool neg_z_loop_bit : neg_z_loop_bits) {
-        r = r.cyclotomic_squared();
-        if (neg_z_loop_bit) {
-            r *= elt;
+    // elt^z = ∏ elt^(2^i) over the set bits i of z. The repeated squarings are done in Karabina's compressed form, and
+    // the terms of the product are decompressed together, sharing a single inversion.
+    std::array<fq12, neg_z_num_set_bits - 1> terms;
+    fq12 compressed = elt;
+    size_t num_terms = 0;
+    for (size_t i = 1; i < neg_z_bit_length; ++i) {
+        compressed = compressed.cyclotomic_squared_compressed();
+        if (((neg_z >> i) & 1) != 0) {
+            terms[num_terms++] = compressed;
         }
     }
+    fq12::batch_decompress_karabina(terms);
+
+    // z is odd, so elt itself is the first term
+    fq12 r = elt;
+    for (const auto& term : terms) {
+        r *= term;
+    }
     return r.unitary_inverse();
 }
 
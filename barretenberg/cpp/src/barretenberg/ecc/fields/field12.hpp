@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/numeric/random/engine.hpp"
+#include <array>
 
 namespace barretenberg {
 template <typename quadratic_field, typename base_field, typename Fq12Params> class field12 {
@@ -223,11 +224,135 @@ template <typename quadratic_field, typename base_field, typename Fq12Params> cl
         };
     }
 
+    /**
+     * Squaring in the cyclotomic subgroup, from Granger and Scott, "Faster Squaring in the Cyclotomic Subgroup of Sixth
+     * Degree Extensions", §3.2. Only valid for elements of the subgroup, e.g. the output of the easy part of the final
+     * exponentiation. Costs 9 fq2 squarings rather than the 6 fq6 multiplications of `sqr`.
+     *
+     * Writing the element as (x0, x1, x2) + (x3, x4, x5)w, the square is
+     * (3ξx4² + 3x0² - 2x0, 3ξx2² + 3x3² - 2x1, 3ξx5² + 3x1² - 2x2) + (6ξx1x5 + 2x3, 6x0x4 + 2x4, 6x2x3 + 2x5)w
+     */
     constexpr field12 cyclotomic_squared() const
     {
-        // Possible Optimization: The cyclotomic squaring can be implemented more than efficiently
-        // than the generic squaring.
-        return sqr();
+        const quadratic_field x4_sqr = c1.c1.sqr();
+        const quadratic_field x0_sqr = c0.c0.sqr();
+        const quadratic_field x0x4_2 = (c1.c1 + c0.c0).sqr() - x4_sqr - x0_sqr;
+        const quadratic_field x2_sqr = c0.c2.sqr();
+        const quadratic_field x3_sqr = c1.c0.sqr();
+        const quadratic_field x2x3_2 = (c0.c2 + c1.c0).sqr() - x2_sqr - x3_sqr;
+        const quadratic_field x5_sqr = c1.c2.sqr();
+        const quadratic_field x1_sqr = c0.c1.sqr();
+        const quadratic_field x1x5_2 = base_field::mul_by_non_residue((c1.c2 + c0.c1).sqr() - x5_sqr - x1_sqr);
+
+        const quadratic_field t0 = base_field::mul_by_non_residue(x4_sqr) + x0_sqr;
+        const quadratic_field t1 = base_field::mul_by_non_residue(x2_sqr) + x3_sqr;
+        const quadratic_field t2 = base_field::mul_by_non_residue(x5_sqr) + x1_sqr;
+
+        field12 result;
+        result.c0.c0 = (t0 - c0.c0) + (t0 - c0.c0) + t0;
+        result.c0.c1 = (t1 - c0.c1) + (t1 - c0.c1) + t1;
+        result.c0.c2 = (t2 - c0.c2) + (t2 - c0.c2) + t2;
+        result.c1.c0 = (x1x5_2 + c1.c0) + (x1x5_2 + c1.c0) + x1x5_2;
+        result.c1.c1 = (x0x4_2 + c1.c1) + (x0x4_2 + c1.c1) + x0x4_2;
+        result.c1.c2 = (x2x3_2 + c1.c2) + (x2x3_2 + c1.c2) + x2x3_2;
+        return result;
+    }
+
+    /**
+     * Karabina's compressed squaring in the cyclotomic subgroup ("Squaring in Cyclotomic Subgroups", Theorem 3.2).
+     *
+     * Only the coefficients g1 = c0.c1, g2 = c0.c2, g3 = c1.c0 and g5 = c1.c2 are read and computed (c0.c0 and c1.c1 of
+     * the result are zero), at a cost of 6 fq2 squarings. Chains of compressed squarings must be brought back to the
+     * usual representation with `batch_decompress_karabina` before any other operation.
+     */
+    constexpr field12 cyclotomic_squared_compressed() const
+    {
+        const quadratic_field& g1 = c0.c1;
+        const quadratic_field& g2 = c0.c2;
+        const quadratic_field& g3 = c1.c0;
+        const quadratic_field& g5 = c1.c2;
+
+        const quadratic_field g1_sqr = g1.sqr();
+        const quadratic_field g5_sqr = g5.sqr();
+        const quadratic_field g2_sqr = g2.sqr();
+        const quadratic_field g3_sqr = g3.sqr();
+        const quadratic_field g1g5_2 = (g1 + g5).sqr() - g1_sqr - g5_sqr;
+        const quadratic_field g2g3_2 = (g2 + g3).sqr() - g2_sqr - g3_sqr;
+
+        field12 result = zero();
+        // h1 = 3(g3² + ξg2²) - 2g1
+        quadratic_field t = g3_sqr + base_field::mul_by_non_residue(g2_sqr);
+        result.c0.c1 = (t - g1) + (t - g1) + t;
+        // h2 = 3(g1² + ξg5²) - 2g2
+        t = g1_sqr + base_field::mul_by_non_residue(g5_sqr);
+        result.c0.c2 = (t - g2) + (t - g2) + t;
+        // h3 = 6ξg1g5 + 2g3
+        t = base_field::mul_by_non_residue(g1g5_2);
+        result.c1.c0 = (t + g3) + (t + g3) + t;
+        // h5 = 6g2g3 + 2g5
+        result.c1.c2 = (g2g3_2 + g5) + (g2g3_2 + g5) + g2g3_2;
+        return result;
+    }
+
+    /**
+     * Recovers g0 and g4 of elements produced by `cyclotomic_squared_compressed`, sharing one fq2 inversion between all
+     * of them:
+     *   g4 = (ξg5² + 3g1² - 2g2) / 4g3   if g3 ≠ 0,   and g4 = 2g1g5 / g2 otherwise,
+     *   g0 = ξ(2g4² + g3g5 - 3g1g2) + 1.
+     * An element with g2 = g3 = 0 is the identity.
+     */
+    template <size_t N> static constexpr void batch_decompress_karabina(std::array<field12, N>& elements)
+    {
+        std::array<quadratic_field, N> numerators;
+        std::array<quadratic_field, N> denominators;
+        std::array<bool, N> is_one{};
+        for (size_t i = 0; i < N; ++i) {
+            const quadratic_field& g1 = elements[i].c0.c1;
+            const quadratic_field& g2 = elements[i].c0.c2;
+            const quadratic_field& g3 = elements[i].c1.c0;
+            const quadratic_field& g5 = elements[i].c1.c2;
+            if (g3.is_zero()) {
+                numerators[i] = g1 * g5;
+                numerators[i] += numerators[i];
+                denominators[i] = g2;
+                if (g2.is_zero()) {
+                    is_one[i] = true;
+                    denominators[i] = quadratic_field::one();
+                }
+            } else {
+                const quadratic_field g1_sqr = g1.sqr();
+                numerators[i] = base_field::mul_by_non_residue(g5.sqr()) + (g1_sqr - g2) + (g1_sqr - g2) + g1_sqr;
+                denominators[i] = g3 + g3;
+                denominators[i] += denominators[i];
+            }
+        }
+
+        // Montgomery's batch inversion trick
+        std::array<quadratic_field, N> prefix_products;
+        quadratic_field accumulator = quadratic_field::one();
+        for (size_t i = 0; i < N; ++i) {
+            prefix_products[i] = accumulator;
+            accumulator *= denominators[i];
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = N; i > 0; --i) {
+            const quadratic_field inverse = accumulator * prefix_products[i - 1];
+            accumulator *= denominators[i - 1];
+            denominators[i - 1] = inverse;
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            if (is_one[i]) {
+                elements[i] = one();
+                continue;
+            }
+            field12& element = elements[i];
+            element.c1.c1 = numerators[i] * denominators[i];
+            const quadratic_field g1g2 = element.c0.c1 * element.c0.c2;
+            quadratic_field t = element.c1.c1.sqr() - g1g2;
+            t = t + t - g1g2 + element.c1.c0 * element.c1.c2;
+            element.c0.c0 = base_field::mul_by_non_residue(t) + quadratic_field::one();
+        }
     }
 
     constexpr field12 unitary_inverse() const
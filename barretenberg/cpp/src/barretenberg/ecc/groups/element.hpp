@@ -1,6 +1,7 @@
 #pragma once
 
 #include "affine_element.hpp"
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/compiler_hints.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -8,6 +9,7 @@
 #include "wnaf.hpp"
 #include <array>
 #include <random>
+#include <span>
 #include <vector>
 
 namespace barretenberg::group_elements {
@@ -93,6 +95,8 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     static void batch_normalize(element* elements, size_t num_elements) noexcept;
     static std::vector<affine_element<Fq, Fr, Params>> batch_mul_with_endomorphism(
         const std::vector<affine_element<Fq, Fr, Params>>& points, const Fr& exponent) noexcept;
+    static element batch_mul(std::span<const affine_element<Fq, Fr, Params>> points,
+                             std::span<const Fr> scalars) noexcept;
 
     Fq x;
     Fq y;
@@ -858,6 +858,125 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     return work_elements;
 }
 
+/**
+ * @brief Multi-scalar multiplication \sum_i scalars_i * points_i, tuned for verifier-sized inputs (Straus' method)
+ *
+ * @details Each scalar is split with the endomorphism into two 127-bit halves, which are written in fixed 4-bit wNAF
+ * form. The odd multiples P, 3P, ..., 15P of every point are computed in Jacobian form and brought to affine form with
+ * a single batch inversion. All points then share one chain of 128 doublings, with one mixed addition per wNAF digit.
+ * Compared to a sum of scalar multiplications this saves the doublings of all but one point and turns every addition
+ * into a mixed one; for up to a few hundred points it also beats Pippenger, whose bucket sums only pay off for larger
+ * inputs.
+ *
+ * Points at infinity and zero scalars are skipped. Curves without an endomorphism fall back to a sum of scalar
+ * multiplications.
+ */
+template <class Fq, class Fr, class T>
+element<Fq, Fr, T> element<Fq, Fr, T>::batch_mul(const std::span<const affine_element<Fq, Fr, T>> points,
+                                                 const std::span<const Fr> scalars) noexcept
+{
+    typedef affine_element<Fq, Fr, T> affine_element;
+    ASSERT(points.size() == scalars.size());
+
+    element accumulator = infinity();
+    if constexpr (!T::USE_ENDOMORPHISM) {
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (!points[i].is_point_at_infinity()) {
+                accumulator += element(points[i]) * scalars[i];
+            }
+        }
+        return accumulator;
+    } else {
+        constexpr size_t num_wnaf_bits = 4;
+        constexpr size_t lookup_size = 1UL << (num_wnaf_bits - 1);
+        constexpr size_t num_rounds = WNAF_SIZE(num_wnaf_bits);
+
+        std::vector<size_t> active_points;
+        active_points.reserve(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (!points[i].is_point_at_infinity() && !scalars[i].is_zero()) {
+                active_points.emplace_back(i);
+            }
+        }
+        const size_t num_points = active_points.size();
+        if (num_points == 0) {
+            return accumulator;
+        }
+
+        // Interleaved wNAFs of the two endomorphism halves of each scalar, most significant digit first
+        std::vector<uint64_t> wnaf_table(num_points * num_rounds * 2);
+        std::vector<bool> skews(num_points * 2);
+        std::vector<element> jacobian_table(num_points * lookup_size);
+        for (size_t j = 0; j < num_points; ++j) {
+            const size_t i = active_points[j];
+            const Fr converted_scalar = scalars[i].from_montgomery_form();
+            Fr endo_scalar;
+            Fr::split_into_endomorphism_scalars(converted_scalar, endo_scalar, *(Fr*)&endo_scalar.data[2]); // NOLINT
+
+            bool skew = false;
+            bool endo_skew = false;
+            uint64_t* wnaf = &wnaf_table[j * num_rounds * 2];
+            wnaf::fixed_wnaf(&endo_scalar.data[0], &wnaf[0], skew, 0, 2, num_wnaf_bits);
+            wnaf::fixed_wnaf(&endo_scalar.data[2], &wnaf[1], endo_skew, 0, 2, num_wnaf_bits);
+            skews[2 * j] = skew;
+            skews[2 * j + 1] = endo_skew;
+
+            element* table = &jacobian_table[j * lookup_size];
+            table[0] = element(points[i]);
+            const element d2 = table[0].dbl();
+            for (size_t k = 1; k < lookup_size; ++k) {
+                table[k] = table[k - 1] + d2;
+            }
+            // (2k + 1) * P is never the point at infinity for a point of prime order, but inputs that are not valid
+            // curve points can end up with z = 0; flag those so that the batch inversion does not fail on them.
+            for (size_t k = 0; k < lookup_size; ++k) {
+                if (table[k].z.is_zero()) {
+                    table[k].self_set_infinity();
+                }
+            }
+        }
+        batch_normalize(&jacobian_table[0], jacobian_table.size());
+        std::vector<affine_element> lookup_table;
+        lookup_table.reserve(jacobian_table.size());
+        for (const auto& table_entry : jacobian_table) {
+            lookup_table.emplace_back(table_entry.x, table_entry.y);
+        }
+
+        const Fq beta = Fq::cube_root_of_unity();
+        for (size_t round = 0; round < num_rounds; ++round) {
+            if (round != 0) {
+                for (size_t k = 0; k < num_wnaf_bits; ++k) {
+                    accumulator.self_dbl();
+                }
+            }
+            for (size_t j = 0; j < num_points; ++j) {
+                for (size_t half = 0; half < 2; ++half) {
+                    const uint64_t wnaf_entry = wnaf_table[j * num_rounds * 2 + round * 2 + half];
+                    const uint64_t index = wnaf_entry & 0x0fffffffU;
+                    const bool sign = static_cast<bool>((wnaf_entry >> 31) & 1);
+                    auto to_add = lookup_table[j * lookup_size + static_cast<size_t>(index)];
+                    to_add.y.self_conditional_negate(sign ^ (half == 1));
+                    if (half == 1) {
+                        to_add.x *= beta;
+                    }
+                    accumulator += to_add;
+                }
+            }
+        }
+
+        for (size_t j = 0; j < num_points; ++j) {
+            const affine_element& point = lookup_table[j * lookup_size];
+            if (skews[2 * j]) {
+                accumulator += -point;
+            }
+            if (skews[2 * j + 1]) {
+                accumulator += affine_element(point.x * beta, point.y);
+            }
+        }
+        return accumulator;
+    }
+}
+
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr, T>& in,
                                                    affine_element<Fq, Fr, T>& out,
@@ -880,10 +880,9 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     using Element = typename Curve::Element;
 
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
-    // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
-    // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms
-    // Pippenger
-    const size_t threshold = get_num_cpus_pow2() * 8;
+    // If we fall below this theshold, or below the size at which Pippenger's bucket sums start to pay off, fall back to
+    // Straus' algorithm (`Element::batch_mul`), with the points split across threads.
+    const size_t threshold = std::max(get_num_cpus_pow2() * 8, STRAUS_MAX_POINTS);
 
     if (num_initial_points == 0) {
         Element out = Group::one;
@@ -892,16 +891,25 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     }
 
     if (num_initial_points <= threshold) {
-        std::vector<Element> exponentiation_results(num_initial_points);
-        // might as well multithread this...
-        // Possible optimization: use group::batch_mul_with_endomorphism here.
-        parallel_for(num_initial_points,
-                     [&](size_t i) { exponentiation_results[i] = Element(points[i * 2]) * scalars[i]; });
-
-        for (size_t i = num_initial_points - 1; i > 0; --i) {
-            exponentiation_results[i - 1] += exponentiation_results[i];
+        const size_t num_threads =
+            std::max(std::min(get_num_cpus(), num_initial_points / STRAUS_MIN_POINTS_PER_THREAD), size_t(1));
+        const size_t points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+        std::vector<Element> thread_results(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * points_per_thread;
+            const size_t end = std::min(start + points_per_thread, num_initial_points);
+            std::vector<typename Curve::AffineElement> thread_points;
+            thread_points.reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                thread_points.emplace_back(points[i * 2]);
+            }
+            thread_results[thread_idx] = Element::batch_mul(thread_points, { scalars + start, scalars + end });
+        });
+
+        for (size_t i = num_threads - 1; i > 0; --i) {
+            thread_results[i - 1] += thread_results[i];
         }
-        return exponentiation_results[0];
+        return thread_results[0];
     }
 
     const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
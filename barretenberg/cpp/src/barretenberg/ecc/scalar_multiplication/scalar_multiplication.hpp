@@ -8,6 +8,11 @@
 
 namespace barretenberg::scalar_multiplication {
 
+// Up to this many points, `pippenger` uses Straus' algorithm (`element::batch_mul`) instead of bucket sums.
+constexpr size_t STRAUS_MAX_POINTS = 512;
+// Fewest points worth giving a thread of its own in Straus' algorithm, which shares one doubling chain per thread.
+constexpr size_t STRAUS_MIN_POINTS_PER_THREAD = 8;
+
 constexpr size_t get_num_buckets(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
@@ -103,4 +103,25 @@ TYPED_TEST(ECCVMComposerTests, EqFails)
     bool verified = verifier.verify_proof(proof);
     ASSERT_FALSE(verified);
 }
+
+TYPED_TEST(ECCVMComposerTests, BatchVerifyProofs)
+{
+    using Flavor = TypeParam;
+
+    auto circuit_constructor = generate_trace<Flavor>(&engine);
+    auto composer = ECCVMComposer_<Flavor>();
+    auto prover = composer.create_prover(circuit_constructor);
+    auto proof = prover.construct_proof();
+
+    auto other_circuit_constructor = generate_trace<Flavor>(&engine);
+    auto other_prover = composer.create_prover(other_circuit_constructor);
+    auto other_proof = other_prover.construct_proof();
+
+    auto verifier = composer.create_verifier(circuit_constructor);
+    EXPECT_TRUE(verifier.batch_verify_proofs({ proof, other_proof }));
+
+    // corrupt the final IPA evaluation of the second proof
+    other_proof.proof_data.back() ^= 1;
+    EXPECT_FALSE(verifier.batch_verify_proofs({ proof, other_proof }));
+}
 } // namespace test_eccvm_composer
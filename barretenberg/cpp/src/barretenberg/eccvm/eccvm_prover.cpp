@@ -151,9 +151,10 @@ template <ECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_univariatizatio
         sumcheck_output.challenge, std::move(batched_poly_unshifted), std::move(batched_poly_to_be_shifted));
 
     // Compute and add to trasnscript the commitments [Fold^(i)], i = 1, ..., d-1
+    std::vector<std::span<const FF>> fold_polynomials(gemini_polynomials.begin() + 2, gemini_polynomials.end());
+    auto fold_commitments = commitment_key->batch_commit(fold_polynomials);
     for (size_t l = 0; l < key->log_circuit_size - 1; ++l) {
-        transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1),
-                                     commitment_key->commit(gemini_polynomials[l + 2]));
+        transcript->send_to_verifier({ "Gemini:FOLD_", l + 1 }, fold_commitments[l]);
     }
 }
 
@@ -170,9 +171,8 @@ template <ECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_pcs_evaluation_
         sumcheck_output.challenge, std::move(gemini_polynomials), r_challenge);
 
     for (size_t l = 0; l < key->log_circuit_size; ++l) {
-        std::string label = "Gemini:a_" + std::to_string(l);
         const auto& evaluation = gemini_output.opening_pairs[l + 1].evaluation;
-        transcript->send_to_verifier(label, evaluation);
+        transcript->send_to_verifier({ "Gemini:a_", l }, evaluation);
     }
 }
 
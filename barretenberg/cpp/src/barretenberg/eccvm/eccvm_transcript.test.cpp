@@ -237,6 +237,7 @@ TYPED_TEST(ECCVMTranscriptTests, ProverManifestConsistency)
     // Automatically generate a transcript manifest by constructing a proof
     auto composer = ECCVMComposer_<Flavor>();
     auto prover = composer.create_prover(builder);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Check that the prover generated manifest agrees with the manifest hard coded in this suite
@@ -268,10 +269,12 @@ TYPED_TEST(ECCVMTranscriptTests, VerifierManifestConsistency)
     // Automatically generate a transcript manifest in the prover by constructing a proof
     auto composer = ECCVMComposer_<Flavor>();
     auto prover = composer.create_prover(builder);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Automatically generate a transcript manifest in the verifier by verifying a proof
     auto verifier = composer.create_verifier(builder);
+    verifier.record_manifest = true;
     verifier.verify_proof(proof);
 
     // Check consistency between the manifests generated by the prover and verifier
@@ -4,6 +4,7 @@
 #include "barretenberg/honk/proof_system/power_polynomial.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <iterator>
 
 using namespace barretenberg;
 using namespace proof_system::honk::sumcheck;
@@ -18,12 +19,14 @@ template <typename Flavor>
 ECCVMVerifier_<Flavor>::ECCVMVerifier_(ECCVMVerifier_&& other) noexcept
     : key(std::move(other.key))
     , pcs_verification_key(std::move(other.pcs_verification_key))
+    , record_manifest(other.record_manifest)
 {}
 
 template <typename Flavor> ECCVMVerifier_<Flavor>& ECCVMVerifier_<Flavor>::operator=(ECCVMVerifier_&& other) noexcept
 {
     key = other.key;
     pcs_verification_key = (std::move(other.pcs_verification_key));
+    record_manifest = other.record_manifest;
     commitments.clear();
     pcs_fr_elements.clear();
     return *this;
@@ -34,11 +37,44 @@ template <typename Flavor> ECCVMVerifier_<Flavor>& ECCVMVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk::proof& proof)
+{
+    auto opening_checks = compute_opening_checks(proof);
+    if (!opening_checks.has_value()) {
+        return false;
+    }
+    return PCS::batch_verify(pcs_verification_key, *opening_checks);
+}
+
+/**
+ * @brief Verifies a batch of ECCVM proofs, sharing the MSM over the SRS of all of their IPA openings
+ *
+ * @return true if all of the proofs are valid (with overwhelming probability)
+ */
+template <typename Flavor> bool ECCVMVerifier_<Flavor>::batch_verify_proofs(const std::vector<plonk::proof>& proofs)
+{
+    std::vector<typename PCS::DeferredCheck> opening_checks;
+    for (const auto& proof : proofs) {
+        auto proof_checks = compute_opening_checks(proof);
+        if (!proof_checks.has_value()) {
+            return false;
+        }
+        std::move(proof_checks->begin(), proof_checks->end(), std::back_inserter(opening_checks));
+    }
+    return PCS::batch_verify(pcs_verification_key, opening_checks);
+}
+
+/**
+ * @brief Runs the verifier on an ECCVM proof up to, but excluding, the MSMs over the SRS of its two IPA openings
+ *
+ * @return The deferred checks of the openings, or std::nullopt if the proof has already been found to be invalid
+ */
+template <typename Flavor>
+std::optional<std::vector<typename ECCVMVerifier_<Flavor>::PCS::DeferredCheck>> ECCVMVerifier_<
+    Flavor>::compute_opening_checks(const plonk::proof& proof)
 {
     using FF = typename Flavor::FF;
     using GroupElement = typename Flavor::GroupElement;
     using Commitment = typename Flavor::Commitment;
-    using PCS = typename Flavor::PCS;
     using Curve = typename Flavor::Curve;
     using Gemini = pcs::gemini::GeminiVerifier_<Curve>;
     using Shplonk = pcs::shplonk::ShplonkVerifier_<Curve>;
@@ -50,6 +86,7 @@ template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk
     RelationParameters<FF> relation_parameters;
 
     transcript = std::make_shared<Transcript>(proof.proof_data);
+    transcript->record_manifest = record_manifest;
 
     VerifierCommitments commitments{ key };
     CommitmentLabels commitment_labels;
@@ -57,7 +94,7 @@ template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk
     const auto circuit_size = transcript->template receive_from_prover<uint32_t>("circuit_size");
 
     if (circuit_size != key->circuit_size) {
-        return false;
+        return std::nullopt;
     }
 
     // Utility for extracting commitments from transcript
@@ -164,8 +201,8 @@ template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk
         sumcheck.verify(relation_parameters, alpha, transcript);
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
+        return std::nullopt;
     }
 
     // Execute Gemini/Shplonk verification:
@@ -227,12 +264,12 @@ template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk
     // Produce a Shplonk claim: commitment [Q] - [Q_z], evaluation zero (at random challenge z)
     auto shplonk_claim = Shplonk::reduce_verification(pcs_verification_key, gemini_claim, transcript);
 
-    // Verify the Shplonk claim with KZG or IPA
-    auto multivariate_opening_verified = PCS::verify(pcs_verification_key, shplonk_claim, transcript);
+    // Reduce the Shplonk claim with IPA
+    auto multivariate_opening_check = PCS::reduce_verify(pcs_verification_key, shplonk_claim, transcript);
 
     // Execute transcript consistency univariate opening round
     // TODO(#768): Find a better way to do this. See issue for details.
-    bool univariate_opening_verified = false;
+    typename PCS::DeferredCheck univariate_opening_check;
     {
         auto hack_commitment = receive_commitment("Translation:hack_commitment");
 
@@ -269,10 +306,11 @@ template <typename Flavor> bool ECCVMVerifier_<Flavor>::verify_proof(const plonk
         // Construct and verify batched opening claim
         OpeningClaim batched_univariate_claim = { { evaluation_challenge_x, batched_transcript_eval },
                                                   batched_commitment };
-        univariate_opening_verified = PCS::verify(pcs_verification_key, batched_univariate_claim, transcript);
+        univariate_opening_check = PCS::reduce_verify(pcs_verification_key, batched_univariate_claim, transcript);
     }
 
-    return sumcheck_verified.value() && multivariate_opening_verified && univariate_opening_verified;
+    return std::vector<typename PCS::DeferredCheck>{ std::move(multivariate_opening_check),
+                                                     std::move(univariate_opening_check) };
 }
 
 template class ECCVMVerifier_<honk::flavor::ECCVM>;
@@ -2,6 +2,8 @@
 #include "barretenberg/flavor/ecc_vm.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
+#include <optional>
+#include <vector>
 
 namespace proof_system::honk {
 template <typename Flavor> class ECCVMVerifier_ {
@@ -10,6 +12,7 @@ template <typename Flavor> class ECCVMVerifier_ {
     using VerificationKey = typename Flavor::VerificationKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
     using Transcript = typename Flavor::Transcript;
+    using PCS = typename Flavor::PCS;
 
   public:
     explicit ECCVMVerifier_(const std::shared_ptr<VerificationKey>& verifier_key = nullptr);
@@ -31,12 +34,15 @@ template <typename Flavor> class ECCVMVerifier_ {
     ~ECCVMVerifier_() = default;
 
     bool verify_proof(const plonk::proof& proof);
+    bool batch_verify_proofs(const std::vector<plonk::proof>& proofs);
+    std::optional<std::vector<typename PCS::DeferredCheck>> compute_opening_checks(const plonk::proof& proof);
 
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::map<std::string, FF> pcs_fr_elements;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     std::shared_ptr<Transcript> transcript;
+    bool record_manifest = false; // record the transcript manifest while verifying, e.g. to compare it in tests
 };
 
 extern template class ECCVMVerifier_<honk::flavor::ECCVM>;
@@ -86,6 +86,10 @@ class GoblinUltra {
     // Whether or not the first row of the execution trace is reserved for 0s to enable shifts
     static constexpr bool has_zero_row = true;
 
+    // Hash used by the transcript to derive challenges; Poseidon2 keeps challenge derivation cheap in the recursive
+    // verifier
+    static constexpr TranscriptHash TRANSCRIPT_HASH = TranscriptHash::POSEIDON2;
+
     /**
      * @brief A base class labelling precomputed entities and (ordered) subsets of interest.
      * @details Used to build the proving key and verification key.
@@ -457,6 +461,22 @@ class GoblinUltra {
         FF target_sum;
     };
 
+    /**
+     * @brief Size in bytes of a GoblinUltra proof for a circuit of size 2^log_n with the given number of public inputs
+     * @details Every element of the proof has a fixed serialized size, so the offset of each element (and the length
+     * of the proof) is determined at compile time up to log_n and the number of public inputs. Verifiers use this to
+     * reject a malformed proof before reading any of it.
+     */
+    static constexpr size_t proof_length(size_t log_n, size_t num_public_inputs)
+    {
+        // circuit size, number of public inputs and their offset, followed by the public inputs
+        const size_t preamble_size = 3 * sizeof(uint32_t) + num_public_inputs * sizeof(FF);
+        // witness commitments, sumcheck round univariates and evaluations, ZeroMorph commitments C_q_k, C_q and C_pi
+        return preamble_size + NUM_WITNESS_ENTITIES * sizeof(Commitment) +
+               log_n * sizeof(barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>) +
+               NUM_ALL_ENTITIES * sizeof(FF) + (log_n + 2) * sizeof(Commitment);
+    }
+
     /**
      * @brief Derived class that defines proof structure for GoblinUltra proofs, as well as supporting functions.
      * Note: Made generic for use in GoblinUltraRecursive.
@@ -487,10 +507,12 @@ class GoblinUltra {
         Commitment zm_cq_comm;
         Commitment zm_pi_comm;
 
-        Transcript_() = default;
+        Transcript_()
+            : BaseTranscript(TRANSCRIPT_HASH)
+        {}
 
         Transcript_(const std::vector<uint8_t>& proof)
-            : BaseTranscript(proof)
+            : BaseTranscript(proof, TRANSCRIPT_HASH)
         {}
 
         void deserialize_full_transcript()
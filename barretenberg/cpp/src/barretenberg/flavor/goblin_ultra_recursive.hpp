@@ -73,6 +73,7 @@ template <typename BuilderType> class GoblinUltraRecursive_ {
     // length = 3
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = MAX_PARTIAL_RELATION_LENGTH + 1;
     static constexpr size_t NUM_RELATIONS = std::tuple_size<Relations>::value;
+    static constexpr TranscriptHash TRANSCRIPT_HASH = flavor::GoblinUltra::TRANSCRIPT_HASH;
 
     // define the container for storing the univariate contribution from each relation in Sumcheck
     using SumcheckTupleOfTuplesOfUnivariates = decltype(create_sumcheck_tuple_of_tuples_of_univariates<Relations>());
@@ -75,6 +75,10 @@ class Ultra {
     // Whether or not the first row of the execution trace is reserved for 0s to enable shifts
     static constexpr bool has_zero_row = true;
 
+    // Hash used by the transcript to derive challenges; Poseidon2 keeps challenge derivation cheap in the recursive
+    // verifier
+    static constexpr TranscriptHash TRANSCRIPT_HASH = TranscriptHash::POSEIDON2;
+
   private:
     /**
      * @brief A base class labelling precomputed entities and (ordered) subsets of interest.
@@ -438,6 +442,22 @@ class Ultra {
         FF target_sum;
     };
 
+    /**
+     * @brief Size in bytes of an Ultra proof for a circuit of size 2^log_n with the given number of public inputs
+     * @details Every element of the proof has a fixed serialized size, so the offset of each element (and the length
+     * of the proof) is determined at compile time up to log_n and the number of public inputs. Verifiers use this to
+     * reject a malformed proof before reading any of it.
+     */
+    static constexpr size_t proof_length(size_t log_n, size_t num_public_inputs)
+    {
+        // circuit size, number of public inputs and their offset, followed by the public inputs
+        const size_t preamble_size = 3 * sizeof(uint32_t) + num_public_inputs * sizeof(FF);
+        // witness commitments, sumcheck round univariates and evaluations, ZeroMorph commitments C_q_k, C_q and C_pi
+        return preamble_size + NUM_WITNESS_ENTITIES * sizeof(Commitment) +
+               log_n * sizeof(barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>) +
+               NUM_ALL_ENTITIES * sizeof(FF) + (log_n + 2) * sizeof(Commitment);
+    }
+
     /**
      * @brief Derived class that defines proof structure for Ultra proofs, as well as supporting functions.
      *
@@ -462,16 +482,19 @@ class Ultra {
         Commitment zm_cq_comm;
         Commitment zm_pi_comm;
 
-        Transcript() = default;
+        Transcript()
+            : BaseTranscript(TRANSCRIPT_HASH)
+        {}
 
         // Used by verifier to initialize the transcript
         Transcript(const std::vector<uint8_t>& proof)
-            : BaseTranscript(proof)
+            : BaseTranscript(proof, TRANSCRIPT_HASH)
         {}
 
         static std::shared_ptr<Transcript> prover_init_empty()
         {
             auto transcript = std::make_shared<Transcript>();
+            transcript->record_manifest = true;
             constexpr uint32_t init{ 42 }; // arbitrary
             transcript->send_to_verifier("Init", init);
             return transcript;
@@ -480,6 +503,7 @@ class Ultra {
         static std::shared_ptr<Transcript> verifier_init_empty(const std::shared_ptr<Transcript>& transcript)
         {
             auto verifier_transcript = std::make_shared<Transcript>(transcript->proof_data);
+            verifier_transcript->record_manifest = true;
             [[maybe_unused]] auto _ = verifier_transcript->template receive_from_prover<uint32_t>("Init");
             return verifier_transcript;
         };
@@ -85,6 +85,8 @@ template <typename BuilderType> class UltraRecursive_ {
     // length = 3
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = MAX_PARTIAL_RELATION_LENGTH + 1;
     static constexpr size_t NUM_RELATIONS = std::tuple_size<Relations>::value;
+    // The transcript must hash the proof the same way as the native prover
+    static constexpr TranscriptHash TRANSCRIPT_HASH = flavor::Ultra::TRANSCRIPT_HASH;
 
     // define the container for storing the univariate contribution from each relation in Sumcheck
     using SumcheckTupleOfTuplesOfUnivariates = decltype(create_sumcheck_tuple_of_tuples_of_univariates<Relations>());
@@ -824,4 +824,48 @@ TEST(ultra_plonk_composer, range_constraint_small_variable)
     EXPECT_EQ(result, true);
 }
 
+TYPED_TEST(ultra_plonk_composer, batch_verify_proofs)
+{
+    // Proofs of the same circuit with different witnesses share a verification key.
+    const auto create_circuit = [](uint64_t x) {
+        auto builder = UltraCircuitBuilder();
+        uint32_t x_idx = builder.add_public_variable(fr(x));
+        uint32_t y_idx = builder.add_variable(fr(x) * fr(x) + fr(x));
+        builder.create_poly_gate({ x_idx, x_idx, y_idx, fr(1), fr(1), fr(0), fr(-1), fr(0) });
+        builder.create_range_constraint(x_idx, 16, "x out of range");
+        return builder;
+    };
+
+    constexpr size_t num_proofs = 4;
+    std::vector<plonk::proof> proofs;
+    auto builder = create_circuit(1);
+    auto composer = UltraComposer();
+    auto verifier = [&]() {
+        if constexpr (TypeParam::use_keccak) {
+            return composer.create_ultra_with_keccak_verifier(builder);
+        } else {
+            return composer.create_verifier(builder);
+        }
+    }();
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto proof_builder = create_circuit(static_cast<uint64_t>(i + 1) * 1000);
+        auto proof_composer = UltraComposer(composer.circuit_proving_key, composer.circuit_verification_key);
+        if constexpr (TypeParam::use_keccak) {
+            auto prover = proof_composer.create_ultra_with_keccak_prover(proof_builder);
+            proofs.emplace_back(prover.construct_proof());
+        } else {
+            auto prover = proof_composer.create_prover(proof_builder);
+            proofs.emplace_back(prover.construct_proof());
+        }
+        EXPECT_TRUE(verifier.verify_proof(proofs.back()));
+    }
+
+    EXPECT_TRUE(verifier.batch_verify_proofs(proofs));
+
+    // Changing a public input invalidates one of the proofs, and with it the whole batch.
+    proofs[2].proof_data[31] ^= 1;
+    EXPECT_FALSE(verifier.verify_proof(proofs[2]));
+    EXPECT_FALSE(verifier.batch_verify_proofs(proofs));
+}
+
 } // namespace proof_system::plonk::test_ultra_plonk_composer
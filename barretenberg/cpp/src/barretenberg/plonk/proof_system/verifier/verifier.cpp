@@ -2,6 +2,7 @@
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -37,6 +38,29 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
 }
 
 template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    const auto P_affine = compute_pairing_points(proof);
+
+    // The final pairing check of step 12.
+    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine.data(), key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == barretenberg::fq12::one());
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::batch_verify_proofs(const std::vector<plonk::proof>& proofs)
+{
+    std::vector<barretenberg::pairing::pairing_points> points;
+    points.reserve(proofs.size());
+    for (const auto& proof : proofs) {
+        points.emplace_back(compute_pairing_points(proof));
+    }
+    return barretenberg::pairing::batch_pairing_check(points, key->reference_string->get_precomputed_g2_lines());
+}
+
+template <typename program_settings>
+barretenberg::pairing::pairing_points VerifierBase<program_settings>::compute_pairing_points(const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -48,6 +72,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Proof π_SNARK must first be added to the transcript with the other program_settings.
 
     key->program_width = program_settings::program_width;
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
 
     // Add the proof data to the transcript, according to the manifest. Also initialize the transcript's hash type and
     // challenge bytes.
@@ -226,16 +252,7 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
 
     g1::element::batch_normalize(P, 2);
 
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
-
-    // The final pairing check of step 12.
-    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
-
-    return (result == barretenberg::fq12::one());
+    return { g1::affine_element{ P[0].x, P[0].y }, g1::affine_element{ P[1].x, P[1].y } };
 }
 
 template class VerifierBase<standard_verifier_settings>;
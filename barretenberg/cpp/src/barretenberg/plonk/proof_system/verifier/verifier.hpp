@@ -2,6 +2,7 @@
 #include "../types/program_settings.hpp"
 #include "../types/proof.hpp"
 #include "../widgets/random_widgets/random_widget.hpp"
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
 #include "barretenberg/plonk/transcript/manifest.hpp"
 
@@ -20,6 +21,19 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * @brief Verifies several proofs against this verifier's key with a single final exponentiation.
+     * @details The pairing points of each proof are folded with random scalars (see
+     * `barretenberg::pairing::batch_pairing_check`). Returns true only if every proof is valid; throws like
+     * `verify_proof` if a proof is malformed.
+     */
+    bool batch_verify_proofs(const std::vector<plonk::proof>& proofs);
+
+    /**
+     * @brief Runs every step of `verify_proof` except the final pairing check, and returns its two G1 inputs.
+     */
+    barretenberg::pairing::pairing_points compute_pairing_points(const plonk::proof& proof);
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
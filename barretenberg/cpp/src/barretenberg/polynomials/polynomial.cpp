@@ -147,6 +147,16 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
     return p;
 }
 
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share(size_t offset, size_t size) const
+{
+    ASSERT(offset + size <= size_);
+    Polynomial p;
+    p.backing_memory_ = backing_memory_;
+    p.size_ = size;
+    p.coefficients_ = coefficients_ + offset;
+    return p;
+}
+
 template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z, const size_t target_size) const
 {
     return polynomial_arithmetic::evaluate(coefficients_, z, target_size);
@@ -58,6 +58,12 @@ template <typename Fr> class Polynomial {
      */
     Polynomial share() const;
 
+    /**
+     * Return a shallow clone of the coefficients [offset, offset + size). The coefficient that follows them is the
+     * shift padding of the result.
+     */
+    Polynomial share(size_t offset, size_t size) const;
+
     std::array<uint8_t, 32> hash() const { return sha256::sha256(byte_span()); }
 
     void clear()
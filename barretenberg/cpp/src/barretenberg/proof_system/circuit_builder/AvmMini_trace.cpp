@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
@@ -14,24 +15,38 @@
 namespace proof_system {
 
 /**
- * @brief Constructor of a trace builder of AVM. Only serves to set the capacity of the
- *        underlying traces.
+ * @brief Constructor of a trace builder of AVM. Sets the capacity of the memory trace
+ *        and adds the first row.
  */
 AvmMiniTraceBuilder::AvmMiniTraceBuilder()
 {
-    mainTrace.reserve(N);
     memTrace.reserve(N);
+    reset();
 }
 
 /**
  * @brief Resetting the internal state so that a new trace can be rebuilt using the same object.
+ *        The main trace starts with the extra row for the shifted values, so that finalize()
+ *        does not have to insert it in front of all the other rows.
  *
  */
 void AvmMiniTraceBuilder::reset()
 {
     mainTrace.clear();
+    mainTrace.reserve(N);
     memTrace.clear();
     ffMemory.fill(FF(0));
+    mainTrace.push_back(Row{ .avmMini_first = 1 });
+}
+
+/**
+ * @brief The clock value of the next row of the main trace, i.e., the number of rows
+ *        added so far (not counting the first row).
+ *
+ */
+size_t AvmMiniTraceBuilder::currentClk() const
+{
+    return mainTrace.size() - 1;
 }
 
 /**
@@ -61,6 +76,31 @@ bool AvmMiniTraceBuilder::compareMemEntries(const MemoryTraceEntry& left, const
     return left.m_sub_clk < right.m_sub_clk;
 }
 
+/**
+ * @brief Sort the memory trace by address, clock and sub-clock (see compareMemEntries).
+ *        Entries are inserted in increasing (m_clk, m_sub_clk) order, so a stable sort on the
+ *        address alone is enough. As addresses are bounded by MemSize, we use a counting sort.
+ *
+ */
+void AvmMiniTraceBuilder::sortMemTrace()
+{
+    std::array<size_t, MemSize + 1> offsets{};
+    for (auto const& entry : memTrace) {
+        offsets.at(entry.m_addr + 1)++;
+    }
+    for (size_t i = 1; i <= MemSize; i++) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    std::vector<MemoryTraceEntry> sortedMemTrace(memTrace.size());
+    for (auto const& entry : memTrace) {
+        sortedMemTrace[offsets[entry.m_addr]++] = entry;
+    }
+    memTrace = std::move(sortedMemTrace);
+
+    assert(std::is_sorted(memTrace.begin(), memTrace.end(), compareMemEntries));
+}
+
 /**
  * @brief A method to insert a row/entry in the memory trace.
  *
@@ -94,7 +134,7 @@ void AvmMiniTraceBuilder::insertInMemTrace(uint32_t m_clk, uint32_t m_sub_clk, u
  */
 void AvmMiniTraceBuilder::loadAInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkLoadA, addr, val, false);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkLoadA, addr, val, false);
 }
 
 /**
@@ -106,7 +146,7 @@ void AvmMiniTraceBuilder::loadAInMemTrace(uint32_t addr, FF val)
  */
 void AvmMiniTraceBuilder::loadBInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkLoadB, addr, val, false);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkLoadB, addr, val, false);
 }
 
 /**
@@ -118,7 +158,7 @@ void AvmMiniTraceBuilder::loadBInMemTrace(uint32_t addr, FF val)
  */
 void AvmMiniTraceBuilder::loadCInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkLoadC, addr, val, false);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkLoadC, addr, val, false);
 }
 
 /**
@@ -130,7 +170,7 @@ void AvmMiniTraceBuilder::loadCInMemTrace(uint32_t addr, FF val)
  */
 void AvmMiniTraceBuilder::storeAInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkStoreA, addr, val, true);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkStoreA, addr, val, true);
 }
 
 /**
@@ -142,7 +182,7 @@ void AvmMiniTraceBuilder::storeAInMemTrace(uint32_t addr, FF val)
  */
 void AvmMiniTraceBuilder::storeBInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkStoreB, addr, val, true);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkStoreB, addr, val, true);
 }
 
 /**
@@ -154,7 +194,7 @@ void AvmMiniTraceBuilder::storeBInMemTrace(uint32_t addr, FF val)
  */
 void AvmMiniTraceBuilder::storeCInMemTrace(uint32_t addr, FF val)
 {
-    insertInMemTrace(static_cast<uint32_t>(mainTrace.size()), SubClkStoreC, addr, val, true);
+    insertInMemTrace(static_cast<uint32_t>(currentClk()), SubClkStoreC, addr, val, true);
 }
 
 /**
@@ -172,7 +212,7 @@ void AvmMiniTraceBuilder::add(uint32_t s0, uint32_t s1, uint32_t d0)
     FF c = a + b;
     ffMemory.at(d0) = c;
 
-    auto clk = mainTrace.size();
+    auto clk = currentClk();
 
     // Loading into Ia
     loadAInMemTrace(s0, a);
@@ -235,7 +275,7 @@ void AvmMiniTraceBuilder::callDataCopy(uint32_t s0, uint32_t s1, uint32_t d0, st
         uint32_t mem_idx_c(0);
         uint32_t rwb(0);
         uint32_t rwc(0);
-        auto clk = mainTrace.size();
+        auto clk = currentClk();
 
         FF ia = callDataMem.at(s0 + offset);
         uint32_t mem_op_a(1);
@@ -323,7 +363,7 @@ std::vector<FF> AvmMiniTraceBuilder::returnOP(uint32_t s0, uint32_t s1)
         uint32_t mem_op_c(0);
         uint32_t mem_idx_b(0);
         uint32_t mem_idx_c(0);
-        auto clk = mainTrace.size();
+        auto clk = currentClk();
 
         uint32_t mem_op_a(1);
         uint32_t mem_idx_a = s0 + offset;
@@ -386,16 +426,17 @@ void AvmMiniTraceBuilder::setFFMem(size_t idx, FF el)
 
 /**
  * @brief Finalisation of the memory trace and incorporating it to the main trace.
- *        In particular, sorting the memory trace, setting .m_lastAccess and
- *        adding shifted values (first row). The main trace is moved at the end of
- *        this call.
+ *        In particular, sorting the memory trace and setting .m_lastAccess. The memory
+ *        trace is written directly below the first row (shifted values). The main trace
+ *        is moved out at the end of this call and the builder is reset, so that it can be
+ *        reused to build a new trace.
  *
  * @return The main trace
  */
 std::vector<Row> AvmMiniTraceBuilder::finalize()
 {
     size_t memTraceSize = memTrace.size();
-    size_t mainTraceSize = mainTrace.size();
+    size_t mainTraceSize = currentClk();
 
     // TODO: We will have to handle this through error handling and not an assertion
     // Smaller than N because we have to add an extra initial row to support shifted
@@ -403,21 +444,18 @@ std::vector<Row> AvmMiniTraceBuilder::finalize()
     assert(memTraceSize < N);
     assert(mainTraceSize < N);
 
-    // Sort memTrace
-    std::sort(memTrace.begin(), memTrace.end(), compareMemEntries);
+    sortMemTrace();
 
     // Fill the rest with zeros.
-    size_t zeroRowsNum = N - mainTraceSize - 1;
-    while (zeroRowsNum-- > 0) {
-        mainTrace.push_back(Row{});
-    }
+    mainTrace.resize(N);
 
-    size_t lastIndex = (memTraceSize > mainTraceSize) ? memTraceSize - 1 : mainTraceSize - 1;
+    // Row 0 is the first row, so the last row of both traces is at index max(memTraceSize, mainTraceSize).
+    size_t lastIndex = (memTraceSize > mainTraceSize) ? memTraceSize : mainTraceSize;
     mainTrace.at(lastIndex).avmMini_last = FF(1);
 
     for (size_t i = 0; i < memTraceSize; i++) {
         auto const& src = memTrace.at(i);
-        auto& dest = mainTrace.at(i);
+        auto& dest = mainTrace.at(i + 1);
 
         dest.memTrace_m_clk = FF(src.m_clk);
         dest.memTrace_m_sub_clk = FF(src.m_sub_clk);
@@ -433,11 +471,9 @@ std::vector<Row> AvmMiniTraceBuilder::finalize()
         }
     }
 
-    // Adding extra row for the shifted values at the top of the execution trace.
-    Row first_row = Row{ .avmMini_first = 1 };
-    mainTrace.insert(mainTrace.begin(), first_row);
-
-    return std::move(mainTrace);
+    auto trace = std::move(mainTrace);
+    reset();
+    return trace;
 }
 
 } // namespace proof_system
\ No newline at end of file
@@ -61,12 +61,14 @@ class AvmMiniTraceBuilder {
         bool m_rw;
     };
 
-    std::vector<Row> mainTrace;
+    std::vector<Row> mainTrace; // The first row is reserved for the shifted values.
     std::vector<MemoryTraceEntry> memTrace; // Entries will be sorted by m_clk, m_sub_clk after finalize().
     std::array<FF, MemSize> ffMemory{};     // Memory table for finite field elements
     // Used for simulation of memory table
 
     static bool compareMemEntries(const MemoryTraceEntry& left, const MemoryTraceEntry& right);
+    void sortMemTrace();
+    size_t currentClk() const;
     void insertInMemTrace(uint32_t m_clk, uint32_t m_sub_clk, uint32_t m_addr, FF m_val, bool m_rw);
     void loadAInMemTrace(uint32_t addr, FF val);
     void loadBInMemTrace(uint32_t addr, FF val);
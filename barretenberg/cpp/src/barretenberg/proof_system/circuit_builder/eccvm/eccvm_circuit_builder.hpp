@@ -4,6 +4,7 @@
 #include "./msm_builder.hpp"
 #include "./precomputed_tables_builder.hpp"
 #include "./transcript_builder.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/flavor/ecc_vm.hpp"
@@ -66,21 +67,6 @@ template <typename Flavor> class ECCVMCircuitBuilder {
     std::vector<MSM> get_msms() const
     {
         const uint32_t num_muls = get_number_of_muls();
-        /**
-         * For input point [P], return { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P] }
-         */
-        const auto compute_precomputed_table = [](const AffineElement& base_point) {
-            const auto d2 = Element(base_point).dbl();
-            std::array<AffineElement, POINT_TABLE_SIZE> table;
-            table[POINT_TABLE_SIZE / 2] = base_point;
-            for (size_t i = 1; i < POINT_TABLE_SIZE / 2; ++i) {
-                table[i + POINT_TABLE_SIZE / 2] = Element(table[i + POINT_TABLE_SIZE / 2 - 1]) + d2;
-            }
-            for (size_t i = 0; i < POINT_TABLE_SIZE / 2; ++i) {
-                table[i] = -table[POINT_TABLE_SIZE - 1 - i];
-            }
-            return table;
-        };
         const auto compute_wnaf_slices = [](uint256_t scalar) {
             std::array<int, NUM_WNAF_SLICES> output;
             int previous_slice = 0;
@@ -131,16 +117,17 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         // we create a discontinuity in pc values between the last transcript row and the following empty row)
         uint32_t pc = num_muls;
 
-        const auto process_mul = [&active_msm, &pc, &compute_wnaf_slices, &compute_precomputed_table](
-                                     const auto& scalar, const auto& base_point) {
+        // Lay out the MSMs first: each run of mul ops forms one MSM and every nonzero scalar takes the next pc value.
+        // The wNAF slices and point tables only depend on the scalar and base point, so they are filled in below.
+        const auto process_mul = [&active_msm, &pc](const auto& scalar, const auto& base_point) {
             if (scalar != 0) {
                 active_msm.push_back(ScalarMul{
                     .pc = pc,
                     .scalar = scalar,
                     .base_point = base_point,
-                    .wnaf_slices = compute_wnaf_slices(scalar),
+                    .wnaf_slices = {},
                     .wnaf_skew = (scalar & 1) == 0,
-                    .precomputed_table = compute_precomputed_table(base_point),
+                    .precomputed_table = {},
                 });
                 pc--;
             }
@@ -163,12 +150,57 @@ template <typename Flavor> class ECCVMCircuitBuilder {
         }
 
         ASSERT(pc == 0);
+
+        std::vector<ScalarMul*> muls;
+        muls.reserve(num_muls);
+        for (auto& msm : msms) {
+            for (auto& mul : msm) {
+                muls.push_back(&mul);
+            }
+        }
+
+        /**
+         * For each input point [P], the point table is { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P] }.
+         * Each thread computes the odd multiples [P], 3[P], ..., 15[P] of its points in projective form and converts
+         * them to affine form with a single batch inversion.
+         */
+        static constexpr size_t NUM_ODD_MULTIPLES = POINT_TABLE_SIZE / 2;
+        barretenberg::thread_utils::parallel_for_range(muls.size(), [&](size_t start, size_t end) {
+            std::vector<Element> odd_multiples((end - start) * NUM_ODD_MULTIPLES);
+            for (size_t i = start; i < end; ++i) {
+                auto& mul = *muls[i];
+                mul.wnaf_slices = compute_wnaf_slices(mul.scalar);
+
+                Element* multiples = &odd_multiples[(i - start) * NUM_ODD_MULTIPLES];
+                const Element d2 = Element(mul.base_point).dbl();
+                multiples[0] = mul.base_point;
+                for (size_t j = 1; j < NUM_ODD_MULTIPLES; ++j) {
+                    multiples[j] = multiples[j - 1] + d2;
+                }
+            }
+            Element::batch_normalize(odd_multiples.data(), odd_multiples.size());
+            for (size_t i = start; i < end; ++i) {
+                auto& table = muls[i]->precomputed_table;
+                const Element* multiples = &odd_multiples[(i - start) * NUM_ODD_MULTIPLES];
+                for (size_t j = 0; j < NUM_ODD_MULTIPLES; ++j) {
+                    const Element& point = multiples[j];
+                    table[NUM_ODD_MULTIPLES + j] =
+                        point.is_point_at_infinity() ? AffineElement(point) : AffineElement(point.x, point.y);
+                    table[NUM_ODD_MULTIPLES - 1 - j] = -table[NUM_ODD_MULTIPLES + j];
+                }
+            }
+        });
         return msms;
     }
 
     static std::vector<ScalarMul> get_flattened_scalar_muls(const std::vector<MSM>& msms)
     {
+        size_t num_muls = 0;
+        for (const auto& msm : msms) {
+            num_muls += msm.size();
+        }
         std::vector<ScalarMul> result;
+        result.reserve(num_muls);
         for (const auto& msm : msms) {
             for (const auto& mul : msm) {
                 result.push_back(mul);
@@ -358,28 +390,30 @@ template <typename Flavor> class ECCVMCircuitBuilder {
             polys.lookup_read_counts_0[i + 1] = point_table_read_counts[0][i];
             polys.lookup_read_counts_1[i + 1] = point_table_read_counts[1][i];
         }
-        for (size_t i = 0; i < transcript_state.size(); ++i) {
-            polys.transcript_accumulator_empty[i] = transcript_state[i].accumulator_empty;
-            polys.transcript_add[i] = transcript_state[i].q_add;
-            polys.transcript_mul[i] = transcript_state[i].q_mul;
-            polys.transcript_eq[i] = transcript_state[i].q_eq;
-            polys.transcript_reset_accumulator[i] = transcript_state[i].q_reset_accumulator;
-            polys.transcript_msm_transition[i] = transcript_state[i].msm_transition;
-            polys.transcript_pc[i] = transcript_state[i].pc;
-            polys.transcript_msm_count[i] = transcript_state[i].msm_count;
-            polys.transcript_Px[i] = transcript_state[i].base_x;
-            polys.transcript_Py[i] = transcript_state[i].base_y;
-            polys.transcript_z1[i] = transcript_state[i].z1;
-            polys.transcript_z2[i] = transcript_state[i].z2;
-            polys.transcript_z1zero[i] = transcript_state[i].z1_zero;
-            polys.transcript_z2zero[i] = transcript_state[i].z2_zero;
-            polys.transcript_op[i] = transcript_state[i].opcode;
-            polys.transcript_accumulator_x[i] = transcript_state[i].accumulator_x;
-            polys.transcript_accumulator_y[i] = transcript_state[i].accumulator_y;
-            polys.transcript_msm_x[i] = transcript_state[i].msm_output_x;
-            polys.transcript_msm_y[i] = transcript_state[i].msm_output_y;
-            polys.transcript_collision_check[i] = transcript_state[i].collision_check;
-        }
+        barretenberg::thread_utils::parallel_for_range(transcript_state.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                polys.transcript_accumulator_empty[i] = transcript_state[i].accumulator_empty;
+                polys.transcript_add[i] = transcript_state[i].q_add;
+                polys.transcript_mul[i] = transcript_state[i].q_mul;
+                polys.transcript_eq[i] = transcript_state[i].q_eq;
+                polys.transcript_reset_accumulator[i] = transcript_state[i].q_reset_accumulator;
+                polys.transcript_msm_transition[i] = transcript_state[i].msm_transition;
+                polys.transcript_pc[i] = transcript_state[i].pc;
+                polys.transcript_msm_count[i] = transcript_state[i].msm_count;
+                polys.transcript_Px[i] = transcript_state[i].base_x;
+                polys.transcript_Py[i] = transcript_state[i].base_y;
+                polys.transcript_z1[i] = transcript_state[i].z1;
+                polys.transcript_z2[i] = transcript_state[i].z2;
+                polys.transcript_z1zero[i] = transcript_state[i].z1_zero;
+                polys.transcript_z2zero[i] = transcript_state[i].z2_zero;
+                polys.transcript_op[i] = transcript_state[i].opcode;
+                polys.transcript_accumulator_x[i] = transcript_state[i].accumulator_x;
+                polys.transcript_accumulator_y[i] = transcript_state[i].accumulator_y;
+                polys.transcript_msm_x[i] = transcript_state[i].msm_output_x;
+                polys.transcript_msm_y[i] = transcript_state[i].msm_output_y;
+                polys.transcript_collision_check[i] = transcript_state[i].collision_check;
+            }
+        });
 
         // TODO(@zac-williamson) if final opcode resets accumulator, all subsequent "is_accumulator_empty" row values
         // must be 1. Ideally we find a way to tweak this so that empty rows that do nothing have column values that are
@@ -389,71 +423,76 @@ template <typename Flavor> class ECCVMCircuitBuilder {
                 polys.transcript_accumulator_empty[i] = 1;
             }
         }
-        for (size_t i = 0; i < precompute_table_state.size(); ++i) {
-            // first row is always an empty row (to accommodate shifted polynomials which must have 0 as 1st
-            // coefficient). All other rows in the precompute_table_state represent active wnaf gates (i.e.
-            // precompute_select = 1)
-            polys.precompute_select[i] = (i != 0) ? 1 : 0;
-            polys.precompute_pc[i] = precompute_table_state[i].pc;
-            polys.precompute_point_transition[i] = static_cast<uint64_t>(precompute_table_state[i].point_transition);
-            polys.precompute_round[i] = precompute_table_state[i].round;
-            polys.precompute_scalar_sum[i] = precompute_table_state[i].scalar_sum;
-
-            polys.precompute_s1hi[i] = precompute_table_state[i].s1;
-            polys.precompute_s1lo[i] = precompute_table_state[i].s2;
-            polys.precompute_s2hi[i] = precompute_table_state[i].s3;
-            polys.precompute_s2lo[i] = precompute_table_state[i].s4;
-            polys.precompute_s3hi[i] = precompute_table_state[i].s5;
-            polys.precompute_s3lo[i] = precompute_table_state[i].s6;
-            polys.precompute_s4hi[i] = precompute_table_state[i].s7;
-            polys.precompute_s4lo[i] = precompute_table_state[i].s8;
-            // If skew is active (i.e. we need to subtract a base point from the msm result),
-            // write `7` into rows.precompute_skew. `7`, in binary representation, equals `-1` when converted into WNAF
-            // form
-            polys.precompute_skew[i] = precompute_table_state[i].skew ? 7 : 0;
-
-            polys.precompute_dx[i] = precompute_table_state[i].precompute_double.x;
-            polys.precompute_dy[i] = precompute_table_state[i].precompute_double.y;
-            polys.precompute_tx[i] = precompute_table_state[i].precompute_accumulator.x;
-            polys.precompute_ty[i] = precompute_table_state[i].precompute_accumulator.y;
-        }
+        barretenberg::thread_utils::parallel_for_range(precompute_table_state.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                // first row is always an empty row (to accommodate shifted polynomials which must have 0 as 1st
+                // coefficient). All other rows in the precompute_table_state represent active wnaf gates (i.e.
+                // precompute_select = 1)
+                polys.precompute_select[i] = (i != 0) ? 1 : 0;
+                polys.precompute_pc[i] = precompute_table_state[i].pc;
+                polys.precompute_point_transition[i] =
+                    static_cast<uint64_t>(precompute_table_state[i].point_transition);
+                polys.precompute_round[i] = precompute_table_state[i].round;
+                polys.precompute_scalar_sum[i] = precompute_table_state[i].scalar_sum;
+
+                polys.precompute_s1hi[i] = precompute_table_state[i].s1;
+                polys.precompute_s1lo[i] = precompute_table_state[i].s2;
+                polys.precompute_s2hi[i] = precompute_table_state[i].s3;
+                polys.precompute_s2lo[i] = precompute_table_state[i].s4;
+                polys.precompute_s3hi[i] = precompute_table_state[i].s5;
+                polys.precompute_s3lo[i] = precompute_table_state[i].s6;
+                polys.precompute_s4hi[i] = precompute_table_state[i].s7;
+                polys.precompute_s4lo[i] = precompute_table_state[i].s8;
+                // If skew is active (i.e. we need to subtract a base point from the msm result),
+                // write `7` into rows.precompute_skew. `7`, in binary representation, equals `-1` when converted into
+                // WNAF form
+                polys.precompute_skew[i] = precompute_table_state[i].skew ? 7 : 0;
+
+                polys.precompute_dx[i] = precompute_table_state[i].precompute_double.x;
+                polys.precompute_dy[i] = precompute_table_state[i].precompute_double.y;
+                polys.precompute_tx[i] = precompute_table_state[i].precompute_accumulator.x;
+                polys.precompute_ty[i] = precompute_table_state[i].precompute_accumulator.y;
+            }
+        });
 
-        for (size_t i = 0; i < msm_state.size(); ++i) {
-            polys.msm_transition[i] = static_cast<int>(msm_state[i].msm_transition);
-            polys.msm_add[i] = static_cast<int>(msm_state[i].q_add);
-            polys.msm_double[i] = static_cast<int>(msm_state[i].q_double);
-            polys.msm_skew[i] = static_cast<int>(msm_state[i].q_skew);
-            polys.msm_accumulator_x[i] = msm_state[i].accumulator_x;
-            polys.msm_accumulator_y[i] = msm_state[i].accumulator_y;
-            polys.msm_pc[i] = msm_state[i].pc;
-            polys.msm_size_of_msm[i] = msm_state[i].msm_size;
-            polys.msm_count[i] = msm_state[i].msm_count;
-            polys.msm_round[i] = msm_state[i].msm_round;
-            polys.msm_add1[i] = static_cast<int>(msm_state[i].add_state[0].add);
-            polys.msm_add2[i] = static_cast<int>(msm_state[i].add_state[1].add);
-            polys.msm_add3[i] = static_cast<int>(msm_state[i].add_state[2].add);
-            polys.msm_add4[i] = static_cast<int>(msm_state[i].add_state[3].add);
-            polys.msm_x1[i] = msm_state[i].add_state[0].point.x;
-            polys.msm_y1[i] = msm_state[i].add_state[0].point.y;
-            polys.msm_x2[i] = msm_state[i].add_state[1].point.x;
-            polys.msm_y2[i] = msm_state[i].add_state[1].point.y;
-            polys.msm_x3[i] = msm_state[i].add_state[2].point.x;
-            polys.msm_y3[i] = msm_state[i].add_state[2].point.y;
-            polys.msm_x4[i] = msm_state[i].add_state[3].point.x;
-            polys.msm_y4[i] = msm_state[i].add_state[3].point.y;
-            polys.msm_collision_x1[i] = msm_state[i].add_state[0].collision_inverse;
-            polys.msm_collision_x2[i] = msm_state[i].add_state[1].collision_inverse;
-            polys.msm_collision_x3[i] = msm_state[i].add_state[2].collision_inverse;
-            polys.msm_collision_x4[i] = msm_state[i].add_state[3].collision_inverse;
-            polys.msm_lambda1[i] = msm_state[i].add_state[0].lambda;
-            polys.msm_lambda2[i] = msm_state[i].add_state[1].lambda;
-            polys.msm_lambda3[i] = msm_state[i].add_state[2].lambda;
-            polys.msm_lambda4[i] = msm_state[i].add_state[3].lambda;
-            polys.msm_slice1[i] = msm_state[i].add_state[0].slice;
-            polys.msm_slice2[i] = msm_state[i].add_state[1].slice;
-            polys.msm_slice3[i] = msm_state[i].add_state[2].slice;
-            polys.msm_slice4[i] = msm_state[i].add_state[3].slice;
-        }
+        barretenberg::thread_utils::parallel_for_range(msm_state.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                polys.msm_transition[i] = static_cast<int>(msm_state[i].msm_transition);
+                polys.msm_add[i] = static_cast<int>(msm_state[i].q_add);
+                polys.msm_double[i] = static_cast<int>(msm_state[i].q_double);
+                polys.msm_skew[i] = static_cast<int>(msm_state[i].q_skew);
+                polys.msm_accumulator_x[i] = msm_state[i].accumulator_x;
+                polys.msm_accumulator_y[i] = msm_state[i].accumulator_y;
+                polys.msm_pc[i] = msm_state[i].pc;
+                polys.msm_size_of_msm[i] = msm_state[i].msm_size;
+                polys.msm_count[i] = msm_state[i].msm_count;
+                polys.msm_round[i] = msm_state[i].msm_round;
+                polys.msm_add1[i] = static_cast<int>(msm_state[i].add_state[0].add);
+                polys.msm_add2[i] = static_cast<int>(msm_state[i].add_state[1].add);
+                polys.msm_add3[i] = static_cast<int>(msm_state[i].add_state[2].add);
+                polys.msm_add4[i] = static_cast<int>(msm_state[i].add_state[3].add);
+                polys.msm_x1[i] = msm_state[i].add_state[0].point.x;
+                polys.msm_y1[i] = msm_state[i].add_state[0].point.y;
+                polys.msm_x2[i] = msm_state[i].add_state[1].point.x;
+                polys.msm_y2[i] = msm_state[i].add_state[1].point.y;
+                polys.msm_x3[i] = msm_state[i].add_state[2].point.x;
+                polys.msm_y3[i] = msm_state[i].add_state[2].point.y;
+                polys.msm_x4[i] = msm_state[i].add_state[3].point.x;
+                polys.msm_y4[i] = msm_state[i].add_state[3].point.y;
+                polys.msm_collision_x1[i] = msm_state[i].add_state[0].collision_inverse;
+                polys.msm_collision_x2[i] = msm_state[i].add_state[1].collision_inverse;
+                polys.msm_collision_x3[i] = msm_state[i].add_state[2].collision_inverse;
+                polys.msm_collision_x4[i] = msm_state[i].add_state[3].collision_inverse;
+                polys.msm_lambda1[i] = msm_state[i].add_state[0].lambda;
+                polys.msm_lambda2[i] = msm_state[i].add_state[1].lambda;
+                polys.msm_lambda3[i] = msm_state[i].add_state[2].lambda;
+                polys.msm_lambda4[i] = msm_state[i].add_state[3].lambda;
+                polys.msm_slice1[i] = msm_state[i].add_state[0].slice;
+                polys.msm_slice2[i] = msm_state[i].add_state[1].slice;
+                polys.msm_slice3[i] = msm_state[i].add_state[2].slice;
+                polys.msm_slice4[i] = msm_state[i].add_state[3].slice;
+            }
+        });
 
         polys.transcript_mul_shift = Polynomial(polys.transcript_mul.shifted());
         polys.transcript_msm_count_shift = Polynomial(polys.transcript_msm_count.shifted());
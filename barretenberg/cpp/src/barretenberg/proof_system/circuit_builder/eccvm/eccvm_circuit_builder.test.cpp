@@ -270,4 +270,31 @@ TYPED_TEST(ECCVMCircuitBuilderTests, MSM)
     bool result = circuit.check_circuit();
     EXPECT_EQ(result, true);
 }
-} // namespace eccvm_circuit_builder_tests
\ No newline at end of file
+
+/**
+ * @brief Check a trace with enough scalar muls that the point tables and precompute rows are split across threads
+ */
+TYPED_TEST(ECCVMCircuitBuilderTests, ManyMSMs)
+{
+    using Flavor = TypeParam;
+    using G1 = typename Flavor::CycleGroup;
+    using Fr = typename G1::Fr;
+
+    static constexpr size_t num_msms = 8;
+    static constexpr size_t msm_size = 17;
+    auto generators = G1::derive_generators("test generators", msm_size);
+
+    proof_system::ECCVMCircuitBuilder<Flavor> circuit;
+    for (size_t j = 0; j < num_msms; ++j) {
+        typename G1::element expected = G1::point_at_infinity;
+        for (size_t i = 0; i < msm_size; ++i) {
+            Fr scalar = Fr::random_element(&engine);
+            expected += (generators[i] * scalar);
+            circuit.mul_accumulate(generators[i], scalar);
+        }
+        circuit.eq_and_reset(expected);
+    }
+    bool result = circuit.check_circuit();
+    EXPECT_EQ(result, true);
+}
+} // namespace eccvm_circuit_builder_tests
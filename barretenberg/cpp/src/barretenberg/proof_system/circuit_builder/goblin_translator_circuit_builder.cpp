@@ -8,6 +8,7 @@
  *
  */
 #include "goblin_translator_circuit_builder.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -599,12 +600,22 @@ GoblinTranslatorCircuitBuilder::AccumulationInput compute_witness_values_for_one
                                    batching_challenge_v,
                                    evaluation_input_x);
 }
+/**
+ * @brief Compute witness values for every ECCVM operation in the queue and lay them into the wires
+ *
+ * @details The accumulator after op i depends on all later ops, which makes the accumulation a linear recurrence. We
+ * resolve it first with a single cheap Horner pass, after which the witness values for each op (limb decompositions,
+ * quotients and relation limbs) only depend on that op and its previous accumulator, so they are computed in parallel.
+ * Finally the gates are created sequentially, since they allocate variables.
+ *
+ * @param ecc_op_queue
+ */
 void GoblinTranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<ECCOpQueue> ecc_op_queue)
 {
     using Fq = barretenberg::fq;
-    std::vector<Fq> accumulator_trace;
-    Fq current_accumulator(0);
-    if (ecc_op_queue->raw_ops.empty()) {
+    const auto& raw_ops = ecc_op_queue->raw_ops;
+    const size_t num_ops = raw_ops.size();
+    if (num_ops == 0) {
         return;
     }
     // Rename for ease of use
@@ -612,31 +623,33 @@ void GoblinTranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_
     auto v = batching_challenge_v;
 
     // We need to precompute the accumulators at each step, because in the actual circuit we compute the values starting
-    // from the later indices. We need to know the previous accumulator to create the gate
-    for (size_t i = 0; i < ecc_op_queue->raw_ops.size(); i++) {
-        auto& ecc_op = ecc_op_queue->raw_ops[ecc_op_queue->raw_ops.size() - 1 - i];
+    // from the later indices. The previous accumulator of op i is the accumulation of ops i+1, ..., num_ops - 1 (and
+    // zero for the last op)
+    std::vector<Fq> previous_accumulators(num_ops);
+    Fq current_accumulator(0);
+    for (size_t i = num_ops - 1; i > 0; i--) {
+        const auto& ecc_op = raw_ops[i];
         current_accumulator *= x;
         current_accumulator +=
             (Fq(ecc_op.get_opcode_value()) +
              v * (ecc_op.base_point.x + v * (ecc_op.base_point.y + v * (ecc_op.z1 + v * ecc_op.z2))));
-        accumulator_trace.push_back(current_accumulator);
+        previous_accumulators[i - 1] = current_accumulator;
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
-
-    for (auto& raw_op : ecc_op_queue->raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
+    // Compute witness values
+    std::vector<AccumulationInput> accumulation_steps(num_ops);
+    barretenberg::thread_utils::parallel_for_range(num_ops, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            accumulation_steps[i] = compute_witness_values_for_one_ecc_op(raw_ops[i], previous_accumulators[i], v, x);
         }
-        // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
+    });
 
-        // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
+    // And put them into the wires
+    for (auto& wire : wires) {
+        wire.reserve(wire.size() + 2 * num_ops);
+    }
+    for (const auto& accumulation_step : accumulation_steps) {
+        create_accumulation_gate(accumulation_step);
     }
 }
 bool GoblinTranslatorCircuitBuilder::check_circuit()
@@ -6,6 +6,7 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -859,7 +860,22 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
     }
 }
 
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+/**
+ * @brief Deduplicate the witnesses of a range list and return their values in ascending order
+ *
+ * @details Every value in a well-formed list lies in [0, target_range], and the list itself always contains the
+ * target_range / 3 step variables added by `create_range_list`, so a counting sort keyed on the value is linear in the
+ * size of the list. If a value is out of range the circuit is already unsatisfiable; we fall back to a comparison sort
+ * so that the (failing) sort constraint can still be constructed.
+ *
+ * This method only reads from the variable arrays and only writes to `list`, so distinct lists can be sorted
+ * concurrently.
+ *
+ * @param list
+ * @return std::vector<uint32_t> the sorted witness values of the list
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::sort_range_list(RangeList& list)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -881,23 +897,46 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // need to make sure that, in original list, increments of at most 3
     std::vector<uint32_t> sorted_list;
     sorted_list.reserve(list.variable_indices.size());
+    bool values_in_range = true;
     for (const auto variable_index : list.variable_indices) {
         const auto& field_element = this->get_variable(variable_index);
         const uint32_t shrinked_value = (uint32_t)field_element.from_montgomery_form().data[0];
+        values_in_range = values_in_range && (shrinked_value <= list.target_range);
         sorted_list.emplace_back(shrinked_value);
     }
 
-#ifdef NO_TBB
-    std::sort(sorted_list.begin(), sorted_list.end());
-#else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
-#endif
+    if (!values_in_range) {
+        std::sort(sorted_list.begin(), sorted_list.end());
+        return sorted_list;
+    }
+
+    std::vector<uint32_t> value_counts(static_cast<size_t>(list.target_range) + 1, 0);
+    for (const auto value : sorted_list) {
+        value_counts[value]++;
+    }
+    auto it = sorted_list.begin();
+    for (size_t value = 0; value < value_counts.size(); ++value) {
+        it = std::fill_n(it, value_counts[value], static_cast<uint32_t>(value));
+    }
+    return sorted_list;
+}
+
+/**
+ * @brief Add the tau-tagged sorted witnesses of a range list and constrain them with a sort-with-edges gate chain
+ *
+ * @param list A range list that has been processed by `sort_range_list`
+ * @param sorted_list The output of `sort_range_list(list)`
+ */
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::create_range_list_gates(const RangeList& list,
+                                                                    const std::vector<uint32_t>& sorted_list)
+{
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
     constexpr size_t gate_width = NUM_WIRES;
     size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
 
     std::vector<uint32_t> indices;
-    indices.reserve(padding + sorted_list.size());
+    indices.reserve(padding + sorted_list.size() + gate_width);
 
     if (list.variable_indices.size() <= gate_width) {
         padding += gate_width;
@@ -913,10 +952,34 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     create_sort_constraint_with_edges(indices, 0, list.target_range);
 }
 
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+{
+    const auto sorted_list = sort_range_list(list);
+    create_range_list_gates(list, sorted_list);
+}
+
+/**
+ * @brief Construct the sort constraints for every range list
+ *
+ * @details Sorting the lists is independent across lists and only reads the variable arrays, so it is performed in
+ * parallel. Creating variables and gates mutates the builder and is done serially afterwards, in the same order as
+ * `range_lists` is iterated so that the resulting circuit is identical to processing the lists one at a time.
+ */
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_lists()
 {
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
     for (auto& i : range_lists) {
-        process_range_list(i.second);
+        lists.emplace_back(&i.second);
+    }
+
+    std::vector<std::vector<uint32_t>> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+
+    for (size_t i = 0; i < lists.size(); ++i) {
+        create_range_list_gates(*lists[i], sorted_lists[i]);
+        // release the sorted values as soon as their gates exist to keep peak memory down
+        std::vector<uint32_t>().swap(sorted_lists[i]);
     }
 }
 
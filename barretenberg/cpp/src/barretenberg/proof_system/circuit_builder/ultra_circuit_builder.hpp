@@ -1008,6 +1008,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     }
 
     RangeList create_range_list(const uint64_t target_range);
+    std::vector<uint32_t> sort_range_list(RangeList& list);
+    void create_range_list_gates(const RangeList& list, const std::vector<uint32_t>& sorted_list);
     void process_range_list(RangeList& list);
     void process_range_lists();
 
@@ -813,6 +813,38 @@ TEST(ultra_circuit_constructor, range_checks_on_duplicates)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, range_checks_on_many_lists)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    const std::vector<uint64_t> target_ranges = { 3, 7, 100, 255, 1000, (1ULL << 14) - 1 };
+    std::vector<uint32_t> indices;
+    for (const auto target_range : target_ranges) {
+        for (size_t i = 0; i < 100; ++i) {
+            const uint64_t value = engine.get_random_uint64() % (target_range + 1);
+            const uint32_t idx = circuit_constructor.add_variable(value);
+            circuit_constructor.create_new_range_constraint(idx, target_range);
+            indices.emplace_back(idx);
+            // duplicate witnesses and copy constraints must not change the size of the sorted list
+            if (i % 10 == 0) {
+                const uint32_t copy_idx = circuit_constructor.add_variable(value);
+                circuit_constructor.assert_equal(idx, copy_idx);
+                circuit_constructor.create_new_range_constraint(copy_idx, target_range);
+                circuit_constructor.create_new_range_constraint(idx, target_range);
+                indices.emplace_back(copy_idx);
+            }
+        }
+    }
+    circuit_constructor.create_dummy_constraints(indices);
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+
+    // An out-of-range value in any one list must still be caught
+    const uint32_t bad_idx = circuit_constructor.add_variable(256);
+    circuit_constructor.create_new_range_constraint(bad_idx, 255);
+    circuit_constructor.create_dummy_constraints({ bad_idx });
+    EXPECT_FALSE(circuit_constructor.check_circuit());
+}
+
 TEST(ultra_circuit_constructor, check_circuit_showcase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
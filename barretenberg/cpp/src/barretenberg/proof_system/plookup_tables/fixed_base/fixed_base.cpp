@@ -2,12 +2,22 @@
 #include "./fixed_base.hpp"
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/numeric/bitop/rotate.hpp"
 #include "barretenberg/numeric/bitop/sparse_form.hpp"
+
+#include <mutex>
+
 namespace plookup::fixed_base {
 
+namespace {
+// serialises calls to `table::register_point`. Readers of the registry do not take the lock (see fixed_base.hpp)
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex registration_mutex;
+} // namespace
+
 /**
  * @brief Given a base_point [P] and an offset_generator [G], compute a lookup table of MAX_TABLE_SIZE that contains the
  * following terms:
@@ -105,7 +115,60 @@ grumpkin::g1::affine_element table::generate_generator_offset(const grumpkin::g1
  */
 bool table::lookup_table_exists_for_point(const affine_element& input)
 {
-    return (input == LHS_GENERATOR_POINT || input == RHS_GENERATOR_POINT);
+    return get_lookup_table_ids_for_point(input).has_value();
+}
+
+/**
+ * @brief Register an additional base point for which fixed-base scalar multiplications should use plookup tables.
+ *
+ * @details Generates the LO/HI scalar lookup tables (and their offset generators) for `input` and stores them in
+ * registered multitable slot `slot`. Once registered, `cycle_group::batch_mul` will treat constant multiples of
+ * `input` in the same way as multiples of LHS_GENERATOR_POINT / RHS_GENERATOR_POINT.
+ *
+ * The slot determines the lookup table ids (FIXED_BASE_REGISTERED_<slot>_*) that a circuit uses, and therefore its
+ * proving and verification keys. It is chosen by the caller so that the same circuit code always produces the same
+ * keys, no matter which other points have been registered in the process. Code that registers points should treat
+ * its slot assignment as part of the circuit definition.
+ *
+ * Generating the tables costs ~NUM_BASIC_TABLES_PER_BASE_POINT * MAX_TABLE_SIZE point additions, and a circuit that
+ * uses the point pays for NUM_BASIC_TABLES_PER_BASE_POINT * MAX_TABLE_SIZE rows of lookup table. Only register points
+ * that are multiplied often enough to amortise this.
+ *
+ * @note The registry is global and registrations cannot be undone. Registering a point into the slot that already
+ * holds it is a no-op.
+ *
+ * @param slot Ranges from 0 to MAX_NUM_REGISTERED_POINTS - 1
+ * @param input
+ * @return true if `slot` now holds the lookup tables of `input`
+ * @return false if `input` is not a valid (finite, on-curve) point, `slot` is out of range, `slot` holds a different
+ * point, or `input` already has lookup tables elsewhere
+ */
+bool table::register_point(const size_t slot, const affine_element& input)
+{
+    if (slot >= MAX_NUM_REGISTERED_POINTS || input.is_point_at_infinity() || !input.on_curve()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(registration_mutex);
+    if (slot_is_registered[slot].load(std::memory_order_relaxed)) {
+        return registered_points[slot].point == input;
+    }
+    // a point maps to a single pair of table ids
+    if (lookup_table_exists_for_point(input)) {
+        return false;
+    }
+    const affine_element base_point_hi = element(input) * MAX_LO_SCALAR;
+    auto& entry = registered_points[slot];
+    entry.point = input;
+    entry.tables = {
+        generate_tables<BITS_PER_LO_SCALAR>(input),
+        generate_tables<BITS_PER_HI_SCALAR>(base_point_hi),
+    };
+    entry.offset_generators = {
+        generate_generator_offset<BITS_PER_LO_SCALAR>(input),
+        generate_generator_offset<BITS_PER_HI_SCALAR>(base_point_hi),
+    };
+    slot_is_registered[slot].store(true, std::memory_order_release);
+    return true;
 }
 
 /**
@@ -124,6 +187,12 @@ std::optional<std::array<MultiTableId, 2>> table::get_lookup_table_ids_for_point
     if (input == RHS_GENERATOR_POINT) {
         return { { FIXED_BASE_RIGHT_LO, FIXED_BASE_RIGHT_HI } };
     }
+    for (size_t i = 0; i < MAX_NUM_REGISTERED_POINTS; ++i) {
+        if (slot_is_registered[i].load(std::memory_order_acquire) && registered_points[i].point == input) {
+            const size_t lo_id = static_cast<size_t>(FIXED_BASE_REGISTERED_0_LO) + (i * 2);
+            return { { static_cast<MultiTableId>(lo_id), static_cast<MultiTableId>(lo_id + 1) } };
+        }
+    }
     return {};
 }
 
@@ -149,12 +218,41 @@ std::optional<grumpkin::g1::affine_element> table::get_generator_offset_for_tabl
     if (table_id == FIXED_BASE_RIGHT_HI) {
         return fixed_base_table_offset_generators[3];
     }
+    const auto id_var = static_cast<size_t>(table_id);
+    const auto first_registered_id = static_cast<size_t>(FIXED_BASE_REGISTERED_0_LO);
+    if (id_var >= first_registered_id && id_var < first_registered_id + NUM_REGISTERED_MULTI_TABLES) {
+        const size_t registered_index = id_var - first_registered_id;
+        if (slot_is_registered[registered_index / 2].load(std::memory_order_acquire)) {
+            return registered_points[registered_index / 2].offset_generators[registered_index & 1];
+        }
+    }
     return std::nullopt;
 }
 
+/**
+ * @brief Return the software lookup tables that back a given fixed-base multitable
+ *
+ * @param multitable_index Ranges from 0 to NUM_ALL_FIXED_BASE_MULTI_TABLES - 1. Indices >= NUM_FIXED_BASE_MULTI_TABLES
+ *                         refer to registered points and must have been registered
+ * @return const table::fixed_base_scalar_mul_tables&
+ * @throws std::runtime_error if `multitable_index` refers to a slot that holds no registered point
+ */
+const table::fixed_base_scalar_mul_tables& table::get_fixed_base_scalar_mul_tables(const size_t multitable_index)
+{
+    if (multitable_index < NUM_FIXED_BASE_MULTI_TABLES) {
+        return fixed_base_tables[multitable_index];
+    }
+    const size_t registered_index = multitable_index - NUM_FIXED_BASE_MULTI_TABLES;
+    const size_t slot = registered_index / 2;
+    if (slot >= MAX_NUM_REGISTERED_POINTS || !slot_is_registered[slot].load(std::memory_order_acquire)) {
+        throw_or_abort("fixed_base::table: no point is registered in slot " + std::to_string(slot));
+    }
+    return registered_points[slot].tables[registered_index & 1];
+}
+
 using function_ptr = std::array<barretenberg::fr, 2> (*)(const std::array<uint64_t, 2>);
 using function_ptr_table =
-    std::array<std::array<function_ptr, table::MAX_NUM_TABLES_IN_MULTITABLE>, table::NUM_FIXED_BASE_MULTI_TABLES>;
+    std::array<std::array<function_ptr, table::MAX_NUM_TABLES_IN_MULTITABLE>, table::NUM_ALL_FIXED_BASE_MULTI_TABLES>;
 /**
  * @brief create a compile-time static 2D array of all our required `get_basic_fixed_base_table_values` function
  * pointers, so that we can specify the function pointer required for this method call using runtime variables
@@ -165,13 +263,37 @@ using function_ptr_table =
 constexpr function_ptr_table make_function_pointer_table()
 {
     function_ptr_table table;
-    barretenberg::constexpr_for<0, table::NUM_FIXED_BASE_MULTI_TABLES, 1>([&]<size_t i>() {
+    barretenberg::constexpr_for<0, table::NUM_ALL_FIXED_BASE_MULTI_TABLES, 1>([&]<size_t i>() {
         barretenberg::constexpr_for<0, table::MAX_NUM_TABLES_IN_MULTITABLE, 1>(
             [&]<size_t j>() { table[i][j] = &table::get_basic_fixed_base_table_values<i, j>; });
     });
     return table;
 };
 
+/**
+ * @brief Return the BasicTableId of the first (least significant) basic table in a given multitable
+ *
+ * @param multitable_index Ranges from 0 to NUM_ALL_FIXED_BASE_MULTI_TABLES - 1
+ * @return constexpr size_t
+ */
+constexpr size_t get_first_basic_table_id(const size_t multitable_index)
+{
+    constexpr std::array<BasicTableId, table::NUM_FIXED_BASE_MULTI_TABLES> basic_table_ids{
+        FIXED_BASE_0_0,
+        FIXED_BASE_1_0,
+        FIXED_BASE_2_0,
+        FIXED_BASE_3_0,
+    };
+    if (multitable_index < table::NUM_FIXED_BASE_MULTI_TABLES) {
+        return static_cast<size_t>(basic_table_ids[multitable_index]);
+    }
+    // registered points each own NUM_BASIC_TABLES_PER_BASE_POINT consecutive basic tables: LO tables, then HI tables
+    const size_t registered_index = multitable_index - table::NUM_FIXED_BASE_MULTI_TABLES;
+    return static_cast<size_t>(FIXED_BASE_REGISTERED_0_0) +
+           (registered_index / 2) * table::NUM_BASIC_TABLES_PER_BASE_POINT +
+           (registered_index & 1) * table::NUM_TABLES_PER_LO_MULTITABLE;
+}
+
 /**
  * @brief Generate a single fixed-base-scalar-mul plookup table
  *
@@ -186,8 +308,49 @@ template <size_t multitable_index>
 BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_table_index, size_t table_index)
 {
     static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
-    ASSERT(table_index < MAX_NUM_TABLES_IN_MULTITABLE);
+    return generate_basic_fixed_base_table_internal(id, basic_table_index, multitable_index, table_index);
+}
+
+/**
+ * @brief Generate a single fixed-base-scalar-mul plookup table for a registered base point
+ *
+ * @param id the BasicTableId. Must be in [FIXED_BASE_REGISTERED_0_0, FIXED_BASE_REGISTERED_END) and refer to a
+ *           registered point
+ * @param basic_table_index plookup table index
+ * @return BasicTable
+ */
+BasicTable table::generate_basic_registered_fixed_base_table(BasicTableId id, size_t basic_table_index)
+{
+    const auto id_var = static_cast<size_t>(id);
+    ASSERT(id_var >= static_cast<size_t>(FIXED_BASE_REGISTERED_0_0) &&
+           id_var < static_cast<size_t>(FIXED_BASE_REGISTERED_END));
+    const size_t offset = id_var - static_cast<size_t>(FIXED_BASE_REGISTERED_0_0);
+    const size_t registered_point_index = offset / NUM_BASIC_TABLES_PER_BASE_POINT;
+    const size_t table_offset = offset % NUM_BASIC_TABLES_PER_BASE_POINT;
+    const bool is_hi_table = table_offset >= NUM_TABLES_PER_LO_MULTITABLE;
+    const size_t table_index = is_hi_table ? table_offset - NUM_TABLES_PER_LO_MULTITABLE : table_offset;
+    const size_t multitable_index =
+        NUM_FIXED_BASE_MULTI_TABLES + (registered_point_index * 2) + static_cast<size_t>(is_hi_table);
+    return generate_basic_fixed_base_table_internal(id, basic_table_index, multitable_index, table_index);
+}
 
+/**
+ * @brief Generate a single fixed-base-scalar-mul plookup table
+ *
+ * @param id the BasicTableId
+ * @param basic_table_index plookup table index
+ * @param multitable_index which of our multitables is this basic table a part of?
+ * @param table_index This index describes which bit-slice the basic table corresponds to. i.e. table_index = 0 maps to
+ *                    the least significant bit slice
+ * @return BasicTable
+ */
+BasicTable table::generate_basic_fixed_base_table_internal(BasicTableId id,
+                                                           size_t basic_table_index,
+                                                           size_t multitable_index,
+                                                           size_t table_index)
+{
+    ASSERT(multitable_index < NUM_ALL_FIXED_BASE_MULTI_TABLES);
+    ASSERT(table_index < MAX_NUM_TABLES_IN_MULTITABLE);
     const size_t multitable_bits = get_num_bits_of_multi_table(multitable_index);
     const size_t bits_covered_by_previous_tables_in_multitable = BITS_PER_TABLE * table_index;
     const bool is_small_table = (multitable_bits - bits_covered_by_previous_tables_in_multitable) < BITS_PER_TABLE;
@@ -200,7 +363,7 @@ BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_
     table.size = table_size;
     table.use_twin_keys = false;
 
-    const auto& basic_table = fixed_base_tables[multitable_index][table_index];
+    const auto& basic_table = get_fixed_base_scalar_mul_tables(multitable_index)[table_index];
 
     for (size_t i = 0; i < table.size; ++i) {
         table.column_1.emplace_back(i);
@@ -231,25 +394,45 @@ BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_
 template <size_t multitable_index, size_t num_bits> MultiTable table::get_fixed_base_table(const MultiTableId id)
 {
     static_assert(num_bits == BITS_PER_LO_SCALAR || num_bits == BITS_PER_HI_SCALAR);
-    constexpr size_t NUM_TABLES = get_num_tables_per_multi_table<num_bits>();
-    constexpr std::array<BasicTableId, NUM_FIXED_BASE_MULTI_TABLES> basic_table_ids{
-        FIXED_BASE_0_0,
-        FIXED_BASE_1_0,
-        FIXED_BASE_2_0,
-        FIXED_BASE_3_0,
-    };
+    static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
+    static_assert(num_bits == get_num_bits_of_multi_table(multitable_index));
+    return get_fixed_base_table_internal(multitable_index, id);
+}
+
+/**
+ * @brief Generate the multi-table for one of the registered base point slots
+ *
+ * @details Can be called before the slot has been registered: a MultiTable only references basic table ids and
+ * function pointers, the table values are read from the registry when lookups are performed
+ *
+ * @param id Must be in [FIXED_BASE_REGISTERED_0_LO, FIXED_BASE_REGISTERED_0_LO + NUM_REGISTERED_MULTI_TABLES)
+ * @return MultiTable
+ */
+MultiTable table::get_registered_fixed_base_table(const MultiTableId id)
+{
+    const auto id_var = static_cast<size_t>(id);
+    ASSERT(id_var >= static_cast<size_t>(FIXED_BASE_REGISTERED_0_LO) &&
+           id_var < static_cast<size_t>(FIXED_BASE_REGISTERED_0_LO) + NUM_REGISTERED_MULTI_TABLES);
+    return get_fixed_base_table_internal(
+        NUM_FIXED_BASE_MULTI_TABLES + id_var - static_cast<size_t>(FIXED_BASE_REGISTERED_0_LO), id);
+}
+
+MultiTable table::get_fixed_base_table_internal(const size_t multitable_index, const MultiTableId id)
+{
+    ASSERT(multitable_index < NUM_ALL_FIXED_BASE_MULTI_TABLES);
+    const size_t num_bits = get_num_bits_of_multi_table(multitable_index);
+    const size_t num_tables = (num_bits / BITS_PER_TABLE) + ((num_bits % BITS_PER_TABLE == 0) ? 0 : 1);
     constexpr function_ptr_table get_values_from_key_table = make_function_pointer_table();
 
-    MultiTable table(MAX_TABLE_SIZE, 0, 0, NUM_TABLES);
+    MultiTable table(MAX_TABLE_SIZE, 0, 0, num_tables);
     table.id = id;
-    table.get_table_values.resize(NUM_TABLES);
-    table.lookup_ids.resize(NUM_TABLES);
-    for (size_t i = 0; i < NUM_TABLES; ++i) {
+    table.get_table_values.resize(num_tables);
+    table.lookup_ids.resize(num_tables);
+    const size_t first_basic_table_id = get_first_basic_table_id(multitable_index);
+    for (size_t i = 0; i < num_tables; ++i) {
         table.slice_sizes.emplace_back(MAX_TABLE_SIZE);
         table.get_table_values[i] = get_values_from_key_table[multitable_index][i];
-        static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
-        size_t idx = i + static_cast<size_t>(basic_table_ids[multitable_index]);
-        table.lookup_ids[i] = static_cast<plookup::BasicTableId>(idx);
+        table.lookup_ids[i] = static_cast<plookup::BasicTableId>(first_basic_table_id + i);
     }
     return table;
 }
@@ -287,4 +470,9 @@ const std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES>
         table::generate_generator_offset<BITS_PER_HI_SCALAR>(rhs_base_point_hi),
     };
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<table::registered_point, table::MAX_NUM_REGISTERED_POINTS> table::registered_points;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::atomic<bool>, table::MAX_NUM_REGISTERED_POINTS> table::slot_is_registered{};
+
 } // namespace plookup::fixed_base
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
+#include <atomic>
+
 namespace plookup::fixed_base {
 
 /**
@@ -65,23 +67,50 @@ class table : public FixedBaseParams {
      **/
     static const std::array<affine_element, table::NUM_FIXED_BASE_MULTI_TABLES> fixed_base_table_offset_generators;
 
+    /**
+     * @brief A base point registered at runtime via `register_point`, together with its precomputed lookup tables.
+     *        Index 0 of `tables` / `offset_generators` describes the LO scalar slice, index 1 the HI scalar slice
+     */
+    struct registered_point {
+        affine_element point;
+        std::array<fixed_base_scalar_mul_tables, 2> tables;
+        std::array<affine_element, 2> offset_generators;
+    };
+    // A slot whose `slot_is_registered` flag is set is fully populated and never modified again.
+    // A slot is written before its flag is set, so readers that load the flag only ever observe complete entries
+    static std::array<registered_point, MAX_NUM_REGISTERED_POINTS> registered_points;
+    static std::array<std::atomic<bool>, MAX_NUM_REGISTERED_POINTS> slot_is_registered;
+
+    static bool register_point(size_t slot, const affine_element& input);
+
     static bool lookup_table_exists_for_point(const affine_element& input);
     static std::optional<std::array<MultiTableId, 2>> get_lookup_table_ids_for_point(const affine_element& input);
     static std::optional<affine_element> get_generator_offset_for_table_id(MultiTableId table_id);
+    static const fixed_base_scalar_mul_tables& get_fixed_base_scalar_mul_tables(size_t multitable_index);
 
     template <size_t multitable_index>
     static BasicTable generate_basic_fixed_base_table(BasicTableId id, size_t basic_table_index, size_t table_index);
     template <size_t multitable_index, size_t num_bits> static MultiTable get_fixed_base_table(MultiTableId id);
 
+    static BasicTable generate_basic_registered_fixed_base_table(BasicTableId id, size_t basic_table_index);
+    static MultiTable get_registered_fixed_base_table(MultiTableId id);
+
     template <size_t multitable_index, size_t table_index>
     static std::array<barretenberg::fr, 2> get_basic_fixed_base_table_values(const std::array<uint64_t, 2> key)
     {
-        static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
+        static_assert(multitable_index < NUM_ALL_FIXED_BASE_MULTI_TABLES);
         static_assert(table_index < get_num_bits_of_multi_table(multitable_index));
-        const auto& basic_table = fixed_base_tables[multitable_index][table_index];
+        const auto& basic_table = get_fixed_base_scalar_mul_tables(multitable_index)[table_index];
         const auto index = static_cast<size_t>(key[0]);
         return { basic_table[index].x, basic_table[index].y };
     }
+
+  private:
+    static BasicTable generate_basic_fixed_base_table_internal(BasicTableId id,
+                                                               size_t basic_table_index,
+                                                               size_t multitable_index,
+                                                               size_t table_index);
+    static MultiTable get_fixed_base_table_internal(size_t multitable_index, MultiTableId id);
 };
 
 extern template table::affine_element table::generate_generator_offset<table::BITS_PER_LO_SCALAR>(
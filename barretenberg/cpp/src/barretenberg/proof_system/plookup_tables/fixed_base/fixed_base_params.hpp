@@ -46,6 +46,15 @@ struct FixedBaseParams {
     // points.
     static constexpr size_t NUM_FIXED_BASE_BASIC_TABLES = NUM_BASIC_TABLES_PER_BASE_POINT * NUM_POINTS;
 
+    // In addition to our two precomputed base points, up to MAX_NUM_REGISTERED_POINTS further base points can be
+    // registered at runtime (see `table::register_point`). Each registered point reserves a LO and a HI multitable
+    // and NUM_BASIC_TABLES_PER_BASE_POINT basic tables. The table contents are only generated upon registration.
+    static constexpr size_t MAX_NUM_REGISTERED_POINTS = 4;
+    static constexpr size_t NUM_REGISTERED_MULTI_TABLES = MAX_NUM_REGISTERED_POINTS * 2;
+    static constexpr size_t NUM_REGISTERED_BASIC_TABLES = NUM_BASIC_TABLES_PER_BASE_POINT * MAX_NUM_REGISTERED_POINTS;
+    // total number of multitables, precomputed + registered. Registered multitables come after the precomputed ones
+    static constexpr size_t NUM_ALL_FIXED_BASE_MULTI_TABLES = NUM_FIXED_BASE_MULTI_TABLES + NUM_REGISTERED_MULTI_TABLES;
+
     /**
      * @brief For a scalar multiplication table that covers input scalars up to `(1 << num_bits) - 1`,
      *        how many individual lookup tables of max size BITS_PER_TABLE do we need?
@@ -61,16 +70,15 @@ struct FixedBaseParams {
     /**
      * @brief For a given multitable index, how many scalar mul bits are we traversing with our multitable?
      *
-     * @param multitable_index Ranges from 0 to NUM_FIXED_BASE_MULTI_TABLES - 1
+     * @details Multitables alternate between LO and HI scalar slices (even index = LO, odd index = HI)
+     *
+     * @param multitable_index Ranges from 0 to NUM_ALL_FIXED_BASE_MULTI_TABLES - 1
      * @return constexpr size_t
      */
     static constexpr size_t get_num_bits_of_multi_table(const size_t multitable_index)
     {
-        ASSERT(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
-        constexpr std::array<size_t, 4> MULTI_TABLE_BIT_LENGTHS{
-            BITS_PER_LO_SCALAR, BITS_PER_HI_SCALAR, BITS_PER_LO_SCALAR, BITS_PER_HI_SCALAR
-        };
-        return MULTI_TABLE_BIT_LENGTHS[multitable_index];
+        ASSERT(multitable_index < NUM_ALL_FIXED_BASE_MULTI_TABLES);
+        return (multitable_index & 1) == 0 ? BITS_PER_LO_SCALAR : BITS_PER_HI_SCALAR;
     }
 };
 } // namespace plookup
\ No newline at end of file
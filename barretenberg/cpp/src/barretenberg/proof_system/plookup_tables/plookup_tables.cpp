@@ -93,6 +93,10 @@ void init_multi_tables()
         fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
     MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_HI] =
         fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
+    for (size_t i = 0; i < FixedBaseParams::NUM_REGISTERED_MULTI_TABLES; ++i) {
+        const auto id = static_cast<MultiTableId>(static_cast<size_t>(MultiTableId::FIXED_BASE_REGISTERED_0_LO) + i);
+        MULTI_TABLES[id] = fixed_base::table::get_registered_fixed_base_table(id);
+    }
 
     barretenberg::constexpr_for<0, 25, 1>([&]<size_t i>() {
         MULTI_TABLES[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
@@ -45,6 +45,10 @@ inline BasicTable create_basic_table(const BasicTableId id, const size_t index)
         return fixed_base::table::generate_basic_fixed_base_table<3>(
             id, index, id_var - static_cast<size_t>(FIXED_BASE_3_0));
     }
+    if (id_var >= static_cast<size_t>(FIXED_BASE_REGISTERED_0_0) &&
+        id_var < static_cast<size_t>(FIXED_BASE_REGISTERED_END)) {
+        return fixed_base::table::generate_basic_registered_fixed_base_table(id, index);
+    }
     switch (id) {
     case AES_SPARSE_MAP: {
         return sparse_tables::generate_sparse_table_with_rotation<9, 8, 0>(AES_SPARSE_MAP, index);
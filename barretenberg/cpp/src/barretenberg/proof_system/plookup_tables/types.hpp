@@ -73,6 +73,8 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    FIXED_BASE_REGISTERED_0_0,
+    FIXED_BASE_REGISTERED_END = FIXED_BASE_REGISTERED_0_0 + FixedBaseParams::NUM_REGISTERED_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -118,7 +120,8 @@ enum MultiTableId {
     KECCAK_FORMAT_INPUT,
     KECCAK_FORMAT_OUTPUT,
     KECCAK_NORMALIZE_AND_ROTATE,
-    NUM_MULTI_TABLES = KECCAK_NORMALIZE_AND_ROTATE + 25,
+    FIXED_BASE_REGISTERED_0_LO = KECCAK_NORMALIZE_AND_ROTATE + 25,
+    NUM_MULTI_TABLES = FIXED_BASE_REGISTERED_0_LO + FixedBaseParams::NUM_REGISTERED_MULTI_TABLES,
 };
 
 struct MultiTable {
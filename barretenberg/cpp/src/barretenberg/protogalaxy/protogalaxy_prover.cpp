@@ -14,7 +14,7 @@ void ProtoGalaxyProver_<ProverInstances>::finalise_and_send_instance(std::shared
 
     for (size_t i = 0; i < instance->public_inputs.size(); ++i) {
         auto public_input_i = instance->public_inputs[i];
-        transcript->send_to_verifier(domain_separator + "_public_input_" + std::to_string(i), public_input_i);
+        transcript->send_to_verifier({ domain_separator + "_public_input_", i }, public_input_i);
     }
     transcript->send_to_verifier(domain_separator + "_pub_inputs_offset",
                                  static_cast<uint32_t>(instance->pub_inputs_offset));
@@ -77,7 +77,7 @@ void ProtoGalaxyProver_<ProverInstances>::send_accumulator(std::shared_ptr<Insta
 
     for (size_t i = 0; i < instance->public_inputs.size(); ++i) {
         auto public_input_i = instance->public_inputs[i];
-        transcript->send_to_verifier(domain_separator + "_public_input_" + std::to_string(i), public_input_i);
+        transcript->send_to_verifier({ domain_separator + "_public_input_", i }, public_input_i);
     }
 
     transcript->send_to_verifier(domain_separator + "_eta", instance->relation_parameters.eta);
@@ -93,7 +93,7 @@ void ProtoGalaxyProver_<ProverInstances>::send_accumulator(std::shared_ptr<Insta
     auto folding_parameters = instance->folding_parameters;
     transcript->send_to_verifier(domain_separator + "_target_sum", folding_parameters.target_sum);
     for (size_t idx = 0; idx < folding_parameters.gate_challenges.size(); idx++) {
-        transcript->send_to_verifier(domain_separator + "_gate_challenge_" + std::to_string(idx),
+        transcript->send_to_verifier({ domain_separator + "_gate_challenge_", idx },
                                      folding_parameters.gate_challenges[idx]);
     }
 
@@ -144,7 +144,7 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
 
     auto perturbator = compute_perturbator(accumulator, deltas);
     for (size_t idx = 0; idx <= accumulator->log_instance_size; idx++) {
-        transcript->send_to_verifier("perturbator_" + std::to_string(idx), perturbator[idx]);
+        transcript->send_to_verifier({ "perturbator_", idx }, perturbator[idx]);
     }
     assert(perturbator[0] == accumulator->folding_parameters.target_sum);
     auto perturbator_challenge = transcript->get_challenge("perturbator_challenge");
@@ -161,7 +161,7 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
     auto combiner_quotient = compute_combiner_quotient(compressed_perturbator, combiner);
 
     for (size_t idx = ProverInstances::NUM; idx < ProverInstances::BATCHED_EXTENDED_LENGTH; idx++) {
-        transcript->send_to_verifier("combiner_quotient_" + std::to_string(idx), combiner_quotient.value_at(idx));
+        transcript->send_to_verifier({ "combiner_quotient_", idx }, combiner_quotient.value_at(idx));
     }
     auto combiner_challenge = transcript->get_challenge("combiner_quotient_challenge");
 
@@ -195,7 +195,7 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     next_accumulator->folding_parameters = { instances.next_gate_challenges, next_target_sum };
     transcript->send_to_verifier("next_target_sum", next_target_sum);
     for (size_t idx = 0; idx < instances.next_gate_challenges.size(); idx++) {
-        transcript->send_to_verifier("next_gate_challenge_" + std::to_string(idx), instances.next_gate_challenges[idx]);
+        transcript->send_to_verifier({ "next_gate_challenge_", idx }, instances.next_gate_challenges[idx]);
     }
 
     // Initialize prover polynomials
@@ -242,7 +242,7 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
             el += instance->public_inputs[el_idx] * lagranges[inst];
             inst++;
         }
-        transcript->send_to_verifier("next_public_input_" + std::to_string(el_idx), el);
+        transcript->send_to_verifier({ "next_public_input_", el_idx }, el);
         el_idx++;
     }
 
@@ -13,7 +13,7 @@ void ProtoGalaxyVerifier_<VerifierInstances>::receive_accumulator(const std::sha
 
     for (size_t i = 0; i < inst->public_input_size; ++i) {
         auto public_input_i =
-            transcript->template receive_from_prover<FF>(domain_separator + "_public_input_" + std::to_string(i));
+            transcript->template receive_from_prover<FF>({ domain_separator + "_public_input_", i });
         inst->public_inputs.emplace_back(public_input_i);
     }
 
@@ -33,7 +33,7 @@ void ProtoGalaxyVerifier_<VerifierInstances>::receive_accumulator(const std::sha
     inst->folding_parameters.gate_challenges = std::vector<FF>(inst->log_instance_size);
     for (size_t idx = 0; idx < inst->log_instance_size; idx++) {
         inst->folding_parameters.gate_challenges[idx] =
-            transcript->template receive_from_prover<FF>(domain_separator + "_gate_challenge_" + std::to_string(idx));
+            transcript->template receive_from_prover<FF>({ domain_separator + "_gate_challenge_", idx });
     }
     auto comm_view = inst->witness_commitments.get_all();
     auto witness_labels = inst->commitment_labels.get_witness();
@@ -61,7 +61,7 @@ void ProtoGalaxyVerifier_<VerifierInstances>::receive_and_finalise_instance(cons
 
     for (size_t i = 0; i < inst->public_input_size; ++i) {
         auto public_input_i =
-            transcript->template receive_from_prover<FF>(domain_separator + "_public_input_" + std::to_string(i));
+            transcript->template receive_from_prover<FF>({ domain_separator + "_public_input_", i });
         inst->public_inputs.emplace_back(public_input_i);
     }
 
@@ -136,7 +136,7 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
 
     std::vector<FF> perturbator_coeffs(accumulator->log_instance_size + 1);
     for (size_t idx = 0; idx <= accumulator->log_instance_size; idx++) {
-        perturbator_coeffs[idx] = transcript->template receive_from_prover<FF>("perturbator_" + std::to_string(idx));
+        perturbator_coeffs[idx] = transcript->template receive_from_prover<FF>({ "perturbator_", idx });
     }
     ASSERT(perturbator_coeffs[0] == accumulator->folding_parameters.target_sum);
     auto perturbator = Polynomial<FF>(perturbator_coeffs);
@@ -147,7 +147,7 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
     std::array<FF, VerifierInstances::BATCHED_EXTENDED_LENGTH - VerifierInstances::NUM> combiner_quotient_evals;
     for (size_t idx = 0; idx < VerifierInstances::BATCHED_EXTENDED_LENGTH - VerifierInstances::NUM; idx++) {
         combiner_quotient_evals[idx] = transcript->template receive_from_prover<FF>(
-            "combiner_quotient_" + std::to_string(idx + VerifierInstances::NUM));
+            { "combiner_quotient_", idx + VerifierInstances::NUM });
     }
     Univariate<FF, VerifierInstances::BATCHED_EXTENDED_LENGTH, VerifierInstances::NUM> combiner_quotient(
         combiner_quotient_evals);
@@ -165,7 +165,7 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
     auto expected_betas_star =
         update_gate_challenges(perturbator_challenge, accumulator->folding_parameters.gate_challenges, deltas);
     for (size_t idx = 0; idx < accumulator->log_instance_size; idx++) {
-        auto beta_star = transcript->template receive_from_prover<FF>("next_gate_challenge_" + std::to_string(idx));
+        auto beta_star = transcript->template receive_from_prover<FF>({ "next_gate_challenge_", idx });
         verified = verified & (expected_betas_star[idx] == beta_star);
     }
 
@@ -193,7 +193,7 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
             expected_el += instance->public_inputs[el_idx] * lagranges[inst];
             inst++;
         }
-        auto el = transcript->template receive_from_prover<FF>("next_public_input" + std::to_string(el_idx));
+        auto el = transcript->template receive_from_prover<FF>({ "next_public_input", el_idx });
         verified = verified & (el == expected_el);
         el_idx++;
     }
@@ -785,6 +785,49 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerSmall)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, StrausBatchMul)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    for (size_t num_points : std::vector<size_t>{ 1, 2, 17, 100, 512 }) {
+        std::vector<AffineElement> points;
+        std::vector<Fr> scalars;
+        for (size_t i = 0; i < num_points; ++i) {
+            points.emplace_back(Element::random_element());
+            scalars.emplace_back(Fr::random_element());
+        }
+        // Repeated points and zero scalars must be handled
+        if (num_points > 2) {
+            points[1] = points[0];
+            scalars[2] = 0;
+        }
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i] * scalars[i];
+        }
+
+        EXPECT_EQ(Element::batch_mul(points, scalars), expected);
+
+        std::vector<AffineElement> point_table(num_points * 2);
+        std::copy(points.begin(), points.end(), point_table.begin());
+        barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+            &point_table[0], &point_table[0], num_points);
+        barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+        EXPECT_EQ(barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], &point_table[0], num_points, state),
+                  expected);
+
+        // Points at infinity do not contribute to the result of Element::batch_mul
+        points.emplace_back(AffineElement::infinity());
+        scalars.emplace_back(Fr::random_element());
+        EXPECT_EQ(Element::batch_mul(points, scalars), expected);
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerEdgeCaseDbl)
 {
     using Curve = TypeParam;
@@ -140,14 +140,17 @@ field_t<Builder> keccak<Builder>::normalize_and_rotate(const field_ct& limb, fie
     compute_lookup_witnesses_for_limb.template operator()<right_bits, num_right_tables>(right_normalized);
     compute_lookup_witnesses_for_limb.template operator()<left_bits, num_left_tables>(left_normalized);
 
+    // Constant lanes (e.g. the zero capacity lanes of the first block) still need a witness to key the lookup gates
+    ASSERT(limb.context != nullptr);
+    const uint32_t limb_index = limb.is_constant() ? limb.context->put_constant_variable(limb.get_value())
+                                                   : limb.normalize().get_witness_index();
+
     // Call builder method to create plookup constraints.
     // The MultiTable table index can be derived from `lane_idx`
     // Each lane_idx has a different rotation amount, which changes sizes of left/right slices
     // and therefore the selector constants required (i.e. the Q1, Q2, Q3 values in the earlier example)
     const auto accumulator_witnesses = limb.context->create_gates_from_plookup_accumulators(
-        (plookup::MultiTableId)((size_t)KECCAK_NORMALIZE_AND_ROTATE + lane_index),
-        lookup,
-        limb.normalize().get_witness_index());
+        (plookup::MultiTableId)((size_t)KECCAK_NORMALIZE_AND_ROTATE + lane_index), lookup, limb_index);
 
     // extract the most significant bit of the normalized output from the final lookup entry in column C3
     msb = field_ct::from_witness_index(limb.get_context(),
@@ -171,29 +174,6 @@ field_t<Builder> keccak<Builder>::normalize_and_rotate(const field_ct& limb, fie
     }
 }
 
-/**
- * @brief Compute twisted representation of hash lane
- *
- * The THETA round requires computation of XOR(A, ROTL(B, 1))
- *
- * We do this via a 'twisted' base-11 representation.
- *
- * If the bit slices for a regular variable are arranged [b63, ..., b0],
- * the twisted representation is a 65-bit variable [b63, ..., b0, b63]
- *
- * The equivalent of XOR(A, ROTL(B, 1)) is A.twist + 2B.twist (in base-11 form)
- * The output is present in bit slices 1-64
- *
- * @tparam Builder
- * @param internal
- */
-template <typename Builder> void keccak<Builder>::compute_twisted_state(keccak_state& internal)
-{
-    for (size_t i = 0; i < NUM_KECCAK_LANES; ++i) {
-        internal.twisted_state[i] = ((internal.state[i] * 11) + internal.state_msb[i]).normalize();
-    }
-}
-
 /**
  * @brief THETA round
  *
@@ -239,30 +219,29 @@ template <typename Builder> void keccak<Builder>::compute_twisted_state(keccak_s
  * (which can be extracted by removing the least and most significant slices of the output)
  * This is MUCH cheaper than the extra range constraints required for a naive left-rotation
  *
- * Total cost of theta = 20.5 gates per 5 lanes + 25 = 127.5 per round
+ * The twisted lanes are never materialized: twisted_limb = 11 * limb + msb is linear, so each column sum C[i] is
+ * accumulated directly from the 5 lanes and their 5 msbs (4 gates per column, instead of 1 gate per lane to build the
+ * twisted lane plus 2 gates per column to sum them).
+ *
+ * Total cost of theta = 20 + 5 * (16 + 2) + 25 = 135 per round
+ *
+ * If `output_lanes_only` is set, D is only XORed into the lanes that PI moves into the squeezed lanes' row.
  */
-template <typename Builder> void keccak<Builder>::theta(keccak_state& internal)
+template <typename Builder> void keccak<Builder>::theta(keccak_state& internal, const bool output_lanes_only)
 {
     std::array<field_ct, 5> C;
     std::array<field_ct, 5> D;
 
     auto& state = internal.state;
-    const auto& twisted_state = internal.twisted_state;
+    const auto& state_msb = internal.state_msb;
     for (size_t i = 0; i < 5; ++i) {
-
-        /**
-         * field_ct::accumulate can compute 5 addition operations in only 2 gates:
-         * Gate 0 wires [a0, a1, a2, a3]
-         * Gate 1 wires [b0, b1, b2, b3]
-         * b3 = a0 + a1 + a2 + a3
-         * b2 = b3 + b0 + b1
-         * (b2 is the output wire)
-         **/
-        C[i] = field_ct::accumulate({ twisted_state[i],
-                                      twisted_state[5 + i],
-                                      twisted_state[10 + i],
-                                      twisted_state[15 + i],
-                                      twisted_state[20 + i] });
+        std::vector<field_ct> twisted_column;
+        for (size_t j = 0; j < 5; ++j) {
+            twisted_column.emplace_back(state[j * 5 + i] * BASE);
+            twisted_column.emplace_back(state_msb[j * 5 + i]);
+        }
+        // field_ct::accumulate sums 3 values per gate, tracking the running total in the 4th wire
+        C[i] = field_ct::accumulate(twisted_column);
     }
 
     /**
@@ -344,7 +323,9 @@ template <typename Builder> void keccak<Builder>::theta(keccak_state& internal)
     // compute state[j * 5 + i] XOR D[i] in base-11 representation
     for (size_t i = 0; i < 5; ++i) {
         for (size_t j = 0; j < 5; ++j) {
-            state[j * 5 + i] = state[j * 5 + i] + D[i];
+            if (!output_lanes_only || is_output_row_source(j * 5 + i)) {
+                state[j * 5 + i] = state[j * 5 + i] + D[i];
+            }
         }
     }
 }
@@ -374,11 +355,16 @@ template <typename Builder> void keccak<Builder>::theta(keccak_state& internal)
  *
  * N.B. Can reduce lookup costs by using larger lookup tables.
  * Current algo is optimized for lookup tables where sum of all table sizes is < 2^64
+ *
+ * If `output_lanes_only` is set, only the 5 lanes that PI moves into the squeezed lanes' row are processed.
  */
-template <typename Builder> void keccak<Builder>::rho(keccak_state& internal)
+template <typename Builder> void keccak<Builder>::rho(keccak_state& internal, const bool output_lanes_only)
 {
-    constexpr_for<0, NUM_KECCAK_LANES, 1>(
-        [&]<size_t i>() { internal.state[i] = normalize_and_rotate<i>(internal.state[i], internal.state_msb[i]); });
+    constexpr_for<0, NUM_KECCAK_LANES, 1>([&]<size_t i>() {
+        if (!output_lanes_only || is_output_row_source(i)) {
+            internal.state[i] = normalize_and_rotate<i>(internal.state[i], internal.state_msb[i]);
+        }
+    });
 }
 
 /**
@@ -424,16 +410,20 @@ template <typename Builder> void keccak<Builder>::pi(keccak_state& internal)
  *
  * N.B. the KECCAK_CHI_OUTPUT table also has a column for the most significant bit of each lookup.
  *      We use this to create a 'twisted representation of each hash lane (see THETA comments for more details)
+ *
+ * If `output_lanes_only` is set, only the first NUM_OUTPUT_LANES lanes (the ones `sponge_squeeze` reads) are computed.
  * @tparam Builder
  */
-template <typename Builder> void keccak<Builder>::chi(keccak_state& internal)
+template <typename Builder> void keccak<Builder>::chi(keccak_state& internal, const bool output_lanes_only)
 {
     // (cost = 12 * 25 = 300?)
     auto& state = internal.state;
 
-    for (size_t y = 0; y < 5; ++y) {
+    const size_t num_rows = output_lanes_only ? 1 : 5;
+    const size_t num_lanes_per_row = output_lanes_only ? NUM_OUTPUT_LANES : 5;
+    for (size_t y = 0; y < num_rows; ++y) {
         std::array<field_ct, 5> lane_outputs;
-        for (size_t x = 0; x < 5; ++x) {
+        for (size_t x = 0; x < num_lanes_per_row; ++x) {
             const auto A = state[y * 5 + x];
             const auto B = state[y * 5 + ((x + 1) % 5)];
             const auto C = state[y * 5 + ((x + 2) % 5)];
@@ -441,7 +431,7 @@ template <typename Builder> void keccak<Builder>::chi(keccak_state& internal)
             // vv should cost 1 gate
             lane_outputs[x] = (A + A + CHI_OFFSET).add_two(-B, C);
         }
-        for (size_t x = 0; x < 5; ++x) {
+        for (size_t x = 0; x < num_lanes_per_row; ++x) {
             // Normalize lane outputs and assign to internal.state
             auto accumulators = plookup_read<Builder>::get_lookup_accumulators(KECCAK_CHI_OUTPUT, lane_outputs[x]);
             internal.state[y * 5 + x] = accumulators[ColumnIdx::C2][0];
@@ -465,20 +455,23 @@ template <typename Builder> void keccak<Builder>::iota(keccak_state& internal, s
 
     // normalize lane value so that we don't overflow our base11 modulus boundary in the next round
     internal.state[0] = normalize_and_rotate<0>(xor_result, internal.state_msb[0]);
-
-    // No need to add constraints to compute twisted repr if this is the last round
-    if (round != NUM_KECCAK_ROUNDS - 1) {
-        compute_twisted_state(internal);
-    }
 }
 
-template <typename Builder> void keccak<Builder>::keccakf1600(keccak_state& internal)
+/**
+ * @brief Apply the Keccak-f[1600] permutation to the state
+ *
+ * If `is_final_block` is set, nothing but the squeezed lanes is read after the permutation, so the last round only
+ * computes those lanes (and the lanes they depend on). This skips 20 of the 25 RHO lookups and 21 of the 25 CHI
+ * lookups of that round. All other lanes of the state are left in an unspecified state.
+ */
+template <typename Builder> void keccak<Builder>::keccakf1600(keccak_state& internal, const bool is_final_block)
 {
     for (size_t i = 0; i < NUM_KECCAK_ROUNDS; ++i) {
-        theta(internal);
-        rho(internal);
+        const bool output_lanes_only = is_final_block && (i == NUM_KECCAK_ROUNDS - 1);
+        theta(internal, output_lanes_only);
+        rho(internal, output_lanes_only);
         pi(internal);
-        chi(internal);
+        chi(internal, output_lanes_only);
         iota(internal, i);
     }
 }
@@ -502,18 +495,23 @@ void keccak<Builder>::sponge_absorb(keccak_state& internal,
                 internal.state_msb[j] = msb_buffer[j];
             }
             for (size_t j = LIMBS_PER_BLOCK; j < NUM_KECCAK_LANES; ++j) {
-                internal.state[j] = witness_ct::create_constant_witness(internal.context, 0);
-                internal.state_msb[j] = witness_ct::create_constant_witness(internal.context, 0);
+                internal.state[j] = field_ct(internal.context, 0);
+                internal.state_msb[j] = field_ct(internal.context, 0);
             }
         } else {
             for (size_t j = 0; j < LIMBS_PER_BLOCK; ++j) {
-                internal.state[j] += input_buffer[i * LIMBS_PER_BLOCK + j];
+                const field_ct& input_lane = input_buffer[i * LIMBS_PER_BLOCK + j];
+                // XOR-ing in a constant zero lane (pure padding) leaves the already normalized lane unchanged
+                if (input_lane.is_constant() && input_lane.get_value() == 0) {
+                    continue;
+                }
+                internal.state[j] += input_lane;
                 internal.state[j] = normalize_and_rotate<0>(internal.state[j], internal.state_msb[j]);
             }
         }
 
-        compute_twisted_state(internal);
-        keccakf1600(internal);
+        const bool is_final_block = (i == num_blocks - 1);
+        keccakf1600(internal, is_final_block);
 
         // if `i >= num_blocks_with_data` then we want to revert the effects of this block and set `internal_state` to
         // equal `previous`.
@@ -522,12 +520,12 @@ void keccak<Builder>::sponge_absorb(keccak_state& internal,
         // For example, a circuit that hashes up to 544 bytes (but maybe less depending on the witness assignment)
         bool_ct block_predicate = field_ct(i).template ranged_less_than<8>(num_blocks_with_data);
 
-        for (size_t j = 0; j < NUM_KECCAK_LANES; ++j) {
+        // After the final block only the squeezed lanes are read
+        const size_t num_live_lanes = is_final_block ? NUM_OUTPUT_LANES : NUM_KECCAK_LANES;
+        for (size_t j = 0; j < num_live_lanes; ++j) {
             internal.state[j] = field_ct::conditional_assign(block_predicate, internal.state[j], previous.state[j]);
             internal.state_msb[j] =
                 field_ct::conditional_assign(block_predicate, internal.state_msb[j], previous.state_msb[j]);
-            internal.twisted_state[j] =
-                field_ct::conditional_assign(block_predicate, internal.twisted_state[j], previous.twisted_state[j]);
         }
     }
 }
@@ -593,7 +591,7 @@ std::vector<field_t<Builder>> keccak<Builder>::format_input_lanes(byte_array_ct&
     const size_t byte_difference = max_blocks_length - input_size;
     byte_array_ct padding_bytes(ctx, byte_difference);
     for (size_t i = 0; i < byte_difference; ++i) {
-        padding_bytes.set_byte(i, witness_ct::create_constant_witness(ctx, 0));
+        padding_bytes.set_byte(i, field_ct(ctx, 0));
     }
     block_bytes.write(padding_bytes);
 
@@ -606,8 +604,10 @@ std::vector<field_t<Builder>> keccak<Builder>::format_input_lanes(byte_array_ct&
     if (num_bytes.is_constant()) {
         const auto terminating_byte = static_cast<size_t>(num_bytes.get_value());
         const auto terminating_block_byte = static_cast<size_t>(num_real_blocks_bytes.get_value()) - 1;
-        block_bytes.set_byte(terminating_byte, witness_ct::create_constant_witness(ctx, 0x1));
-        block_bytes.set_byte(terminating_block_byte, witness_ct::create_constant_witness(ctx, 0x80));
+        // If both land on the same byte (num_bytes = 135 mod 136), that byte is 0x81
+        const uint64_t terminating_block_value = (terminating_byte == terminating_block_byte) ? 0x81 : 0x80;
+        block_bytes.set_byte(terminating_byte, field_ct(ctx, 0x1));
+        block_bytes.set_byte(terminating_block_byte, field_ct(ctx, terminating_block_value));
     }
 
     // keccak lanes interpret memory as little-endian integers,
@@ -679,10 +679,8 @@ std::vector<field_t<Builder>> keccak<Builder>::format_input_lanes(byte_array_ct&
     // check later on. Should be fine as this translates to ~2MB of input data)
     ASSERT(uint256_t(sliced_buffer.size()) < (uint256_t(1ULL) << Builder::DEFAULT_PLOOKUP_RANGE_BITNUM));
 
-    // If the terminating input byte index matches the terminating block byte index, we set the byte to 0x80.
-    // If we trigger this case, set `terminating_index_limb_addition` to 0 so that we do not write `0x01 + 0x80`
-    terminating_index_limb_addition = field_ct::conditional_assign(
-        field_ct(num_bytes) == field_ct(num_real_blocks_bytes) - 1, 0, terminating_index_limb_addition);
+    // If the terminating input byte index matches the terminating block byte index, both additions below land on
+    // the same byte, giving the 0x81 that keccak's padding requires.
     field_ct terminating_limb;
 
     // iterate over our lanes to perform the above listed checks
@@ -15,7 +15,7 @@ template <typename Builder> class bit_array;
  *
  * UltraPlonk only due to heavy lookup table use.
  *
- * Current cost 17,329 constraints for a 1-block hash
+ * Current cost 16,474 constraints for a 1-block hash (64-byte input)
  * using small(ish) lookup tables (total size < 2^64)
  *
  * @tparam Builder
@@ -43,6 +43,9 @@ template <typename Builder> class keccak {
     // how many limbs fit into a block (17)
     static constexpr size_t LIMBS_PER_BLOCK = BLOCK_SIZE / 8;
 
+    // how many lanes of the final state are squeezed into the hash output (4)
+    static constexpr size_t NUM_OUTPUT_LANES = BITS / 64;
+
     static constexpr size_t NUM_KECCAK_ROUNDS = 24;
 
     // 1 "lane" = 64 bits. Instead of interpreting the keccak sponge as 1,600 bits, it's easier to work over 64-bit
@@ -154,26 +157,31 @@ template <typename Builder> class keccak {
     }
     static constexpr uint256_t CHI_OFFSET = get_chi_offset();
 
+    /**
+     * @brief Does PI move the lane at `lane_index` into the first row (the row holding the squeezed output lanes)?
+     *
+     * PI maps lane (x, y) to (y, 2x + 3y), which lands in row 0 iff x == y, i.e. lanes 0, 6, 12, 18 and 24.
+     */
+    static constexpr bool is_output_row_source(const size_t lane_index) { return lane_index % 6 == 0; }
+
     struct keccak_state {
         std::array<field_ct, NUM_KECCAK_LANES> state;
         std::array<field_ct, NUM_KECCAK_LANES> state_msb;
-        std::array<field_ct, NUM_KECCAK_LANES> twisted_state;
         Builder* context;
     };
 
     template <size_t lane_index> static field_t<Builder> normalize_and_rotate(const field_ct& limb, field_ct& msb);
-    static void compute_twisted_state(keccak_state& internal);
-    static void theta(keccak_state& state);
-    static void rho(keccak_state& state);
+    static void theta(keccak_state& state, bool output_lanes_only);
+    static void rho(keccak_state& state, bool output_lanes_only);
     static void pi(keccak_state& state);
-    static void chi(keccak_state& state);
+    static void chi(keccak_state& state, bool output_lanes_only);
     static void iota(keccak_state& state, size_t round);
     static void sponge_absorb(keccak_state& internal,
                               const std::vector<field_ct>& input_buffer,
                               const std::vector<field_ct>& msb_buffer,
                               const field_ct& num_blocks_with_data);
     static byte_array_ct sponge_squeeze(keccak_state& internal);
-    static void keccakf1600(keccak_state& state);
+    static void keccakf1600(keccak_state& state, bool is_final_block);
     static byte_array_ct hash(byte_array_ct& input, const uint32_ct& num_bytes);
     static byte_array_ct hash(byte_array_ct& input) { return hash(input, static_cast<uint32_t>(input.size())); };
 
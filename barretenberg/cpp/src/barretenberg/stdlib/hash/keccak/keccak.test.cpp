@@ -216,6 +216,35 @@ TEST(stdlib_keccak, test_double_block)
     EXPECT_EQ(proof_result, true);
 }
 
+TEST(stdlib_keccak, test_multi_block_input_lengths)
+{
+    // Cover both sides of a block boundary (135 bytes shares its 0x01 and 0x80 padding byte), and final blocks that
+    // end in padding-only lanes, with both a constant and a witness length.
+    constexpr size_t max_num_bytes = 300;
+    for (const size_t num_bytes : { 1UL, 135UL, 136UL, 300UL }) {
+        std::vector<uint8_t> input_v(max_num_bytes, 0);
+        for (size_t i = 0; i < num_bytes; ++i) {
+            input_v[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+        const std::vector<uint8_t> message(input_v.begin(), input_v.begin() + static_cast<ptrdiff_t>(num_bytes));
+        const std::vector<uint8_t> expected = stdlib::keccak<Builder>::hash_native(message);
+
+        Builder builder = Builder();
+
+        byte_array fixed_input(&builder, message);
+        byte_array fixed_output = stdlib::keccak<Builder>::hash(fixed_input);
+        EXPECT_EQ(fixed_output.get_value(), expected);
+
+        byte_array variable_input(&builder, input_v);
+        uint32_ct length(witness_ct(&builder, static_cast<uint32_t>(num_bytes)));
+        byte_array variable_output = stdlib::keccak<Builder>::hash(variable_input, length);
+        EXPECT_EQ(variable_output.get_value(), expected);
+
+        bool proof_result = builder.check_circuit();
+        EXPECT_EQ(proof_result, true);
+    }
+}
+
 TEST(stdlib_keccak, test_double_block_variable_length)
 {
     Builder builder = Builder();
@@ -0,0 +1,42 @@
+#include "poseidon2.hpp"
+#include "poseidon2_permutation.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+using namespace barretenberg;
+using namespace proof_system;
+
+/**
+ * @brief Hash a vector of field elements
+ *
+ * @details Absorbs `rate = t - 1` elements per permutation into a sponge whose capacity element is initialised with
+ * the input length, then squeezes the first element of the state (see crypto::FieldSponge::hash_internal).
+ */
+template <typename C> field_t<C> poseidon2<C>::hash(C& builder, const std::vector<field_t>& inputs)
+{
+    using Permutation = Poseidon2Permutation<C, crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t t = Permutation::t;
+    constexpr size_t rate = t - 1;
+
+    typename Permutation::State state;
+    for (size_t i = 0; i < rate; ++i) {
+        state[i] = field_t(0);
+    }
+    // domain separator, matches the native sponge with a single output element
+    state[rate] = field_t(static_cast<uint256_t>(inputs.size()) << 64);
+
+    size_t absorbed = 0;
+    do {
+        for (size_t i = 0; i < rate && absorbed + i < inputs.size(); ++i) {
+            state[i] += inputs[absorbed + i];
+        }
+        state = Permutation::permutation(&builder, state);
+        absorbed += rate;
+    } while (absorbed < inputs.size());
+
+    return state[0].normalize();
+}
+
+INSTANTIATE_STDLIB_TYPE(poseidon2);
+
+} // namespace proof_system::plonk::stdlib
@@ -0,0 +1,27 @@
+#pragma once
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+
+#include "../../primitives/circuit_builders/circuit_builders.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+using namespace barretenberg;
+/**
+ * @brief stdlib class that evaluates in-circuit poseidon2 hashes, consistent with behavior in
+ * crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash (a fixed-length sponge hash with rate 3)
+ *
+ * @tparam Builder
+ */
+template <typename Builder> class poseidon2 {
+
+  private:
+    using field_t = stdlib::field_t<Builder>;
+
+  public:
+    static field_t hash(Builder& builder, const std::vector<field_t>& in);
+};
+
+EXTERN_STDLIB_TYPE(poseidon2);
+
+} // namespace proof_system::plonk::stdlib
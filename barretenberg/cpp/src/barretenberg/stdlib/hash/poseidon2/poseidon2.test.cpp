@@ -0,0 +1,102 @@
+#include "poseidon2.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "poseidon2_permutation.hpp"
+
+namespace test_StdlibPoseidon2 {
+using namespace barretenberg;
+using namespace proof_system::plonk;
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+template <typename Builder> class StdlibPoseidon2 : public testing::Test {
+    using field_ct = stdlib::field_t<Builder>;
+    using witness_ct = stdlib::witness_t<Builder>;
+    using poseidon2 = typename stdlib::poseidon2<Builder>;
+    using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+    using Permutation = stdlib::Poseidon2Permutation<Builder, Params>;
+    using NativePermutation = crypto::Poseidon2Permutation<Params>;
+    using NativeHash = crypto::Poseidon2<Params>;
+
+  public:
+    static void test_permutation()
+    {
+        Builder builder;
+
+        typename Permutation::State input;
+        typename NativePermutation::State native_input;
+        for (size_t i = 0; i < Permutation::t; ++i) {
+            native_input[i] = fr::random_element(&engine);
+            // mix witnesses and constants
+            input[i] = (i == 1) ? field_ct(native_input[i]) : field_ct(witness_ct(&builder, native_input[i]));
+        }
+
+        const size_t num_gates_start = builder.get_num_gates();
+        const auto output = Permutation::permutation(&builder, input);
+        info("num gates per permutation = ", builder.get_num_gates() - num_gates_start);
+
+        const auto expected = NativePermutation::permutation(native_input);
+        for (size_t i = 0; i < Permutation::t; ++i) {
+            EXPECT_EQ(output[i].get_value(), expected[i]);
+        }
+        EXPECT_TRUE(builder.check_circuit());
+    }
+
+    static void test_hash()
+    {
+        for (size_t num_inputs = 0; num_inputs < 8; ++num_inputs) {
+            Builder builder;
+
+            std::vector<fr> native_inputs;
+            std::vector<field_ct> inputs;
+            for (size_t i = 0; i < num_inputs; ++i) {
+                native_inputs.emplace_back(fr::random_element(&engine));
+                inputs.emplace_back(witness_ct(&builder, native_inputs.back()));
+            }
+
+            const auto result = poseidon2::hash(builder, inputs);
+            EXPECT_EQ(result.get_value(), NativeHash::hash(native_inputs));
+            EXPECT_TRUE(builder.check_circuit());
+        }
+    }
+
+    static void test_hash_failure()
+    {
+        Builder builder;
+
+        std::vector<field_ct> inputs;
+        for (size_t i = 0; i < 5; ++i) {
+            inputs.emplace_back(witness_ct(&builder, fr::random_element(&engine)));
+        }
+        const auto result = poseidon2::hash(builder, inputs);
+
+        // tamper with the output of the hash
+        builder.variables[builder.real_variable_index[result.witness_index]] += 1;
+        EXPECT_FALSE(builder.check_circuit());
+    }
+};
+
+using CircuitTypes = testing::Types<proof_system::StandardCircuitBuilder,
+                                    proof_system::UltraCircuitBuilder,
+                                    proof_system::GoblinUltraCircuitBuilder>;
+
+TYPED_TEST_SUITE(StdlibPoseidon2, CircuitTypes);
+
+TYPED_TEST(StdlibPoseidon2, TestPermutation)
+{
+    TestFixture::test_permutation();
+};
+
+TYPED_TEST(StdlibPoseidon2, TestHash)
+{
+    TestFixture::test_hash();
+};
+
+TYPED_TEST(StdlibPoseidon2, TestHashFailure)
+{
+    TestFixture::test_hash_failure();
+};
+
+} // namespace test_StdlibPoseidon2
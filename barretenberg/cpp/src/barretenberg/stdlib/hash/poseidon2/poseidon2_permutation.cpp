@@ -0,0 +1,181 @@
+#include "poseidon2_permutation.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+/**
+ * @brief Apply the Poseidon2 permutation to `input`
+ *
+ * @param builder
+ * @param input
+ * @return State
+ */
+template <typename Builder, typename Params>
+typename Poseidon2Permutation<Builder, Params>::State Poseidon2Permutation<Builder, Params>::permutation(
+    Builder* builder, const State& input)
+{
+    State current_state(input);
+
+    // Apply the initial linear layer
+    matrix_multiplication_external(current_state);
+
+    if constexpr (IsGoblinBuilder<Builder>) {
+        return permutation_with_custom_gates(builder, current_state);
+    } else {
+        return permutation_with_arithmetic_gates(current_state);
+    }
+}
+
+/**
+ * @brief Evaluate the rounds of the permutation with the GoblinUltra Poseidon2 gates.
+ *
+ * @details Each gate holds the state entering a round in its wires and takes the round constants from its selectors.
+ * The relation constrains the wires of the next gate to the state leaving the round, so the gates of consecutive rounds
+ * are laid down one after the other and the final output state occupies an extra row without selectors.
+ */
+template <typename Builder, typename Params>
+typename Poseidon2Permutation<Builder, Params>::State Poseidon2Permutation<Builder, Params>::
+    permutation_with_custom_gates(Builder* builder, State& state)
+    requires IsGoblinBuilder<Builder>
+{
+    NativeState native_state;
+    for (size_t i = 0; i < t; ++i) {
+        // the gates operate on witness indices, so constants have to be placed in (fixed) witnesses
+        if (state[i].is_constant()) {
+            state[i] = field_ct::from_witness_index(builder, builder->put_constant_variable(state[i].get_value()));
+        } else {
+            state[i] = state[i].normalize();
+        }
+        native_state[i] = state[i].get_value();
+    }
+
+    const auto add_round_output = [&]() {
+        for (size_t i = 0; i < t; ++i) {
+            state[i] = witness_t<Builder>(builder, native_state[i]);
+        }
+    };
+
+    constexpr size_t rounds_f_beginning = rounds_f / 2;
+    const auto external_round = [&](const size_t round_idx) {
+        builder->create_poseidon2_external_gate({ state[0].witness_index,
+                                                  state[1].witness_index,
+                                                  state[2].witness_index,
+                                                  state[3].witness_index,
+                                                  static_cast<uint32_t>(round_idx) });
+        NativePermutation::add_round_constants(native_state, NativePermutation::round_constants[round_idx]);
+        NativePermutation::apply_sbox(native_state);
+        NativePermutation::matrix_multiplication_external(native_state);
+        add_round_output();
+    };
+
+    for (size_t i = 0; i < rounds_f_beginning; ++i) {
+        external_round(i);
+    }
+
+    const size_t p_end = rounds_f_beginning + rounds_p;
+    for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+        builder->create_poseidon2_internal_gate({ state[0].witness_index,
+                                                  state[1].witness_index,
+                                                  state[2].witness_index,
+                                                  state[3].witness_index,
+                                                  static_cast<uint32_t>(i) });
+        native_state[0] += NativePermutation::round_constants[i][0];
+        NativePermutation::apply_single_sbox(native_state[0]);
+        NativePermutation::matrix_multiplication_internal(native_state);
+        add_round_output();
+    }
+
+    for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+        external_round(i);
+    }
+
+    // The final round constrains the wires of the next row, which therefore has to contain the output state
+    builder->create_dummy_constraints(
+        { state[0].witness_index, state[1].witness_index, state[2].witness_index, state[3].witness_index });
+    return state;
+}
+
+/**
+ * @brief Evaluate the rounds of the permutation with generic arithmetic gates
+ */
+template <typename Builder, typename Params>
+typename Poseidon2Permutation<Builder, Params>::State Poseidon2Permutation<Builder, Params>::
+    permutation_with_arithmetic_gates(State& state)
+{
+    constexpr size_t rounds_f_beginning = rounds_f / 2;
+    const auto external_round = [&](const size_t round_idx) {
+        for (size_t j = 0; j < t; ++j) {
+            // adding a constant is free, it is folded into the gates of the s-box
+            state[j] += NativePermutation::round_constants[round_idx][j];
+            apply_single_sbox(state[j]);
+        }
+        matrix_multiplication_external(state);
+    };
+
+    for (size_t i = 0; i < rounds_f_beginning; ++i) {
+        external_round(i);
+    }
+
+    const size_t p_end = rounds_f_beginning + rounds_p;
+    for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+        state[0] += NativePermutation::round_constants[i][0];
+        apply_single_sbox(state[0]);
+        matrix_multiplication_internal(state);
+    }
+
+    for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+        external_round(i);
+    }
+    return state;
+}
+
+/**
+ * @brief Multiply the state by the external MDS matrix
+ * @details Each output is a linear combination of the four inputs, evaluated with 2 addition gates:
+ *
+ * /         \
+ * | 5 7 1 3 |
+ * | 4 6 1 1 |
+ * | 1 3 5 7 |
+ * | 1 1 4 6 |
+ * \         /
+ */
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::matrix_multiplication_external(State& state)
+{
+    static_assert(t == 4);
+    const auto& [a, b, c, d] = state;
+    State result;
+    result[0] = (a * 5).add_two(b * 7, c) + d * 3;
+    result[1] = (a * 4).add_two(b * 6, c) + d;
+    result[2] = a.add_two(b * 3, c * 5) + d * 7;
+    result[3] = a.add_two(b, c * 4) + d * 6;
+    state = result;
+}
+
+/**
+ * @brief Multiply the state by the internal matrix, i.e. diag(internal_matrix_diagonal) + the all-ones matrix
+ */
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::matrix_multiplication_internal(State& state)
+{
+    const field_ct sum = field_ct::accumulate({ state.begin(), state.end() });
+    for (size_t i = 0; i < t; ++i) {
+        state[i] = state[i] * NativePermutation::internal_matrix_diagonal[i] + sum;
+    }
+}
+
+/**
+ * @brief Compute x^5 with 3 multiplication gates
+ */
+template <typename Builder, typename Params>
+void Poseidon2Permutation<Builder, Params>::apply_single_sbox(field_ct& input)
+{
+    static_assert(Params::d == 5);
+    const field_ct xx = input.sqr();
+    const field_ct xxxx = xx.sqr();
+    input = xxxx * input;
+}
+
+INSTANTIATE_STDLIB_TYPE_VA(Poseidon2Permutation, crypto::Poseidon2Bn254ScalarFieldParams);
+
+} // namespace proof_system::plonk::stdlib
@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+
+#include "../../primitives/circuit_builders/circuit_builders.hpp"
+
+namespace proof_system::plonk::stdlib {
+
+/**
+ * @brief In-circuit Poseidon2 permutation, consistent with crypto::Poseidon2Permutation<Params>
+ *
+ * @details GoblinUltraCircuitBuilder has dedicated Poseidon2 gates that evaluate a complete external or internal round
+ * in a single row, reading the output state from the wires of the following row (~70 gates per permutation).
+ * Builders without these gates evaluate the rounds with field_t arithmetic (~670 gates per permutation).
+ *
+ * @tparam Builder
+ * @tparam Params
+ */
+template <typename Builder, typename Params> class Poseidon2Permutation {
+  public:
+    using NativePermutation = crypto::Poseidon2Permutation<Params>;
+    using field_ct = field_t<Builder>;
+
+    static constexpr size_t t = Params::t;
+    static constexpr size_t rounds_f = Params::rounds_f;
+    static constexpr size_t rounds_p = Params::rounds_p;
+    static constexpr size_t NUM_ROUNDS = Params::rounds_f + Params::rounds_p;
+
+    using State = std::array<field_ct, t>;
+    using NativeState = typename NativePermutation::State;
+
+    static State permutation(Builder* builder, const State& input);
+
+  private:
+    static void matrix_multiplication_external(State& state);
+    static void matrix_multiplication_internal(State& state);
+    static void apply_single_sbox(field_ct& input);
+
+    static State permutation_with_custom_gates(Builder* builder, State& state)
+        requires IsGoblinBuilder<Builder>;
+    static State permutation_with_arithmetic_gates(State& state);
+};
+
+EXTERN_STDLIB_TYPE_VA(Poseidon2Permutation, crypto::Poseidon2Bn254ScalarFieldParams);
+
+} // namespace proof_system::plonk::stdlib
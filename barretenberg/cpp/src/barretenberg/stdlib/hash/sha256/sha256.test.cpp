@@ -428,4 +428,68 @@ TEST(stdlib_sha256, test_input_str_len_multiple)
     }
 }
 
+TEST(stdlib_sha256, test_var_length_matches_fixed_length)
+{
+    // 119 bytes is the longest input that fits in two blocks, so the lengths below cover an empty message, both sides
+    // of the one-block limit and messages whose padding ends exactly on a block boundary.
+    constexpr size_t max_num_bytes = 119;
+    std::vector<uint8_t> input_buf(max_num_bytes);
+    for (auto& byte : input_buf) {
+        byte = engine.get_random_uint8();
+    }
+
+    for (const size_t num_bytes : { 0UL, 3UL, 55UL, 56UL, 63UL, 64UL, 119UL }) {
+        auto builder = Builder();
+        byte_array_ct input(&builder, input_buf);
+        field_ct length = witness_t<Builder>(&builder, num_bytes);
+
+        byte_array_ct output_bits = sha256_plookup::sha256_var<Builder>(input, length);
+
+        const std::vector<uint8_t> message(input_buf.begin(), input_buf.begin() + static_cast<ptrdiff_t>(num_bytes));
+        EXPECT_EQ(output_bits.get_value(), sha256::sha256(message));
+        EXPECT_TRUE(builder.check_circuit());
+    }
+}
+
+TEST(stdlib_sha256, test_var_length_NIST_vector_two)
+{
+    auto builder = Builder();
+
+    // The 56 byte NIST message needs two blocks, padded out here to an input that could take up to three.
+    std::string message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const size_t num_bytes = message.size();
+    message.resize(160, 'x');
+
+    byte_array_ct input(&builder, message);
+    field_ct length = witness_t<Builder>(&builder, num_bytes);
+    packed_byte_array_ct output_bits = sha256_plookup::sha256_var<Builder>(input, length);
+
+    std::vector<field_ct> output = output_bits.to_unverified_byte_slices(4);
+
+    EXPECT_EQ(output[0].get_value(), fr(0x248D6A61ULL));
+    EXPECT_EQ(output[1].get_value(), fr(0xD20638B8ULL));
+    EXPECT_EQ(output[2].get_value(), fr(0xE5C02693ULL));
+    EXPECT_EQ(output[3].get_value(), fr(0x0C3E6039ULL));
+    EXPECT_EQ(output[4].get_value(), fr(0xA33CE459ULL));
+    EXPECT_EQ(output[5].get_value(), fr(0x64FF2167ULL));
+    EXPECT_EQ(output[6].get_value(), fr(0xF6ECEDD4ULL));
+    EXPECT_EQ(output[7].get_value(), fr(0x19DB06C1ULL));
+    info("num gates = ", builder.get_num_gates());
+
+    bool proof_result = builder.check_circuit();
+    EXPECT_EQ(proof_result, true);
+}
+
+TEST(stdlib_sha256, test_var_length_rejects_length_past_input)
+{
+    auto builder = Builder();
+
+    byte_array_ct input(&builder, "abc");
+    field_ct length = witness_t<Builder>(&builder, 4);
+    sha256_plookup::sha256_var<Builder>(input, length);
+
+    bool proof_result = builder.check_circuit();
+    EXPECT_EQ(proof_result, false);
+}
+
 } // namespace proof_system::test_stdlib_sha256
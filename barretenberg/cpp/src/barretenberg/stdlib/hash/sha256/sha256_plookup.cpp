@@ -3,6 +3,7 @@
 #include "barretenberg/proof_system/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/proof_system/plookup_tables/sha256.hpp"
 #include "barretenberg/stdlib/primitives/bit_array/bit_array.hpp"
+#include "barretenberg/stdlib/primitives/bool/bool.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "barretenberg/stdlib/primitives/plookup/plookup.hpp"
 #include "barretenberg/stdlib/primitives/uint/uint.hpp"
@@ -131,8 +132,6 @@ std::array<field_t<Builder>, 64> extend_witness(const std::array<field_t<Builder
 
         field_pt xor_result = plookup_read<Builder>::read_from_1_to_2_table(SHA256_WITNESS_OUTPUT, xor_result_sparse);
 
-        // TODO NORMALIZE WITH RANGE CHECK
-
         field_pt w_out_raw = xor_result.add_two(w_sparse[i - 16].normal, w_sparse[i - 7].normal);
         field_pt w_out;
         if (w_out_raw.witness_index == IS_CONSTANT) {
@@ -141,6 +140,12 @@ std::array<field_t<Builder>, 64> extend_witness(const std::array<field_t<Builder
         } else {
             w_out = witness_t<Builder>(
                 ctx, fr(w_out_raw.get_value().from_montgomery_form().data[0] & (uint64_t)0xffffffffULL));
+
+            // w_out_raw is the sum of three 32-bit values, so w_out_raw = w_out + divisor * 2^32 with divisor < 4.
+            // Scaling both terms before subtracting keeps the divisor a single arithmetic gate.
+            static constexpr fr inv_pow_two = fr(2).pow(32).invert();
+            field_pt divisor = (w_out_raw * inv_pow_two - w_out * inv_pow_two).normalize();
+            ctx->create_new_range_constraint(divisor.witness_index, 3);
         }
         w_sparse[i] = sparse_witness_limbs(w_out);
     }
@@ -148,6 +153,11 @@ std::array<field_t<Builder>, 64> extend_witness(const std::array<field_t<Builder
     std::array<field_pt, 64> w_extended;
 
     for (size_t i = 0; i < 64; ++i) {
+        // Words that were decomposed by a SHA256_WITNESS_INPUT lookup are already known to fit in 32 bits; the last
+        // two schedule words never are, so range constrain them explicitly.
+        if (i >= 16 && !w_sparse[i].has_sparse_limbs) {
+            w_sparse[i].normal.create_range_constraint(32);
+        }
         w_extended[i] = w_sparse[i].normal;
     }
     return w_extended;
@@ -241,13 +251,23 @@ template <typename Builder> field_t<Builder> add_normalize(const field_t<Builder
 
     field_pt result = a.add_two(b, overflow * field_pt(ctx, -fr((uint64_t)(1ULL << 32ULL))));
 
-    overflow.create_range_constraint(3);
+    // The overflow already sits in the addition gate above, so it can be tagged directly with a small range list
+    // rather than going through decompose_into_default_range (which always adds an extra accumulator gate).
+    ctx->create_new_range_constraint(overflow.witness_index, 7);
     return result;
 }
 
+/**
+ * @brief Applies the SHA-256 compression function to one 512-bit block.
+ *
+ * @details When `range_constrain_all_outputs` is false the block output is assumed to feed another block: words 0-2 and
+ * 4-6 are then decomposed by the next block's sparse form lookups, which constrain them to 32 bits for free, so only
+ * words 3 and 7 (which the next block only adds) are range constrained here.
+ */
 template <typename Builder>
 std::array<field_t<Builder>, 8> sha256_block(const std::array<field_t<Builder>, 8>& h_init,
-                                             const std::array<field_t<Builder>, 16>& input)
+                                             const std::array<field_t<Builder>, 16>& input,
+                                             const bool range_constrain_all_outputs)
 {
     typedef field_t<Builder> field_pt;
 
@@ -263,16 +283,18 @@ std::array<field_t<Builder>, 8> sha256_block(const std::array<field_t<Builder>,
     };
 
     /**
-     * Initialize round variables with previous block output
+     * Initialize round variables with previous block output.
+     * Only b, c, f and g are needed in sparse form up front: the first round's majority and choose look up a and e
+     * themselves, and d and h are only ever added to.
      **/
-    auto a = map_into_maj_sparse_form(h_init[0]);
+    sparse_value<Builder> a(h_init[0]);
     auto b = map_into_maj_sparse_form(h_init[1]);
     auto c = map_into_maj_sparse_form(h_init[2]);
-    auto d = map_into_maj_sparse_form(h_init[3]);
-    auto e = map_into_choose_sparse_form(h_init[4]);
+    sparse_value<Builder> d(h_init[3]);
+    sparse_value<Builder> e(h_init[4]);
     auto f = map_into_choose_sparse_form(h_init[5]);
     auto g = map_into_choose_sparse_form(h_init[6]);
-    auto h = map_into_choose_sparse_form(h_init[7]);
+    sparse_value<Builder> h(h_init[7]);
 
     /**
      * Extend witness
@@ -317,7 +339,9 @@ std::array<field_t<Builder>, 8> sha256_block(const std::array<field_t<Builder>,
      * compression function because the outputs of the lookup table ensures that the output is contrained to 32 bits.
      */
     for (size_t i = 0; i < 8; i++) {
-        output[i].create_range_constraint(32);
+        if (range_constrain_all_outputs || i == 3 || i == 7) {
+            output[i].create_range_constraint(32);
+        }
     }
 
     return output;
@@ -356,16 +380,111 @@ template <typename Builder> packed_byte_array<Builder> sha256(const packed_byte_
         for (size_t j = 0; j < 16; ++j) {
             hash_input[j] = slices[i * slices_per_block + j];
         }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
+        rolling_hash = sha256_block(rolling_hash, hash_input, i + 1 == num_blocks);
     }
 
     std::vector<field_pt> output(rolling_hash.begin(), rolling_hash.end());
     return packed_byte_array<Builder>(output, 4);
 }
+
+/**
+ * @brief Hashes the first `num_bytes` bytes of `input`, where `num_bytes` is a circuit value of at most input.size().
+ *
+ * @details The circuit is sized for the longest message: every block that an input.size() byte message needs is
+ * compressed, and the digest is selected from the output of the block that actually ends the message. A single
+ * padding circuit covers every length. The prover supplies a one-hot selector is_end[j] marking byte j == num_bytes,
+ * whose running sum masks out the bytes past the message, so that padded byte j is mask[j] * input[j] + 0x80 *
+ * is_end[j]. The message ends in block k iff its 0x80 byte lies in [64k - 8, 64k + 56), so the same selectors give the
+ * one-hot block selector that places the bit length in the final block and picks out the digest.
+ */
+template <typename Builder>
+packed_byte_array<Builder> sha256_var(const byte_array<Builder>& input, const field_t<Builder>& num_bytes)
+{
+    typedef field_t<Builder> field_pt;
+    typedef witness_t<Builder> witness_pt;
+
+    if (num_bytes.is_constant()) {
+        const size_t length = static_cast<size_t>(uint256_t(num_bytes.get_value()).data[0]);
+        ASSERT(length <= input.size());
+        return sha256<Builder>(input.slice(0, length));
+    }
+
+    Builder* ctx = num_bytes.get_context();
+
+    const size_t max_num_bytes = input.size();
+    // Keeps the bit length of the message within the last word of the padded message.
+    ASSERT(max_num_bytes < (1UL << 29));
+
+    constexpr size_t bytes_per_block = 64;
+    const size_t num_blocks = internal::get_num_blocks(max_num_bytes * 8);
+
+    // Booleanity, a sum of one and a weighted sum of num_bytes make is_end one-hot at num_bytes. This also constrains
+    // num_bytes to [0, max_num_bytes].
+    const uint256_t length = num_bytes.get_value();
+    std::vector<field_pt> is_end(max_num_bytes + 1);
+    std::vector<field_pt> weighted_is_end(max_num_bytes + 1);
+    for (size_t j = 0; j <= max_num_bytes; ++j) {
+        is_end[j] = bool_t<Builder>(witness_pt(ctx, length == uint256_t(j)));
+        weighted_is_end[j] = is_end[j] * fr(j);
+    }
+    field_pt::accumulate(is_end).assert_equal(field_pt(ctx, 1), "sha256_var: num_bytes exceeds input size");
+    field_pt::accumulate(weighted_is_end).assert_equal(num_bytes, "sha256_var: num_bytes exceeds input size");
+
+    std::vector<field_pt> padded(num_blocks * bytes_per_block, field_pt(ctx, 0));
+    std::vector<std::vector<field_pt>> is_end_in_block(num_blocks);
+    field_pt num_ended(ctx, 0);
+    for (size_t j = 0; j <= max_num_bytes; ++j) {
+        num_ended = num_ended + is_end[j];
+        if (j < max_num_bytes) {
+            padded[j] = input[j].madd(field_pt(ctx, 1) - num_ended, is_end[j] * fr(128));
+        } else {
+            padded[j] = is_end[j] * fr(128);
+        }
+        is_end_in_block[(j + 8) / bytes_per_block].push_back(is_end[j]);
+    }
+
+    const field_pt bit_length = num_bytes * fr(8);
+
+    std::array<field_pt, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    std::array<field_pt, 8> digest;
+    digest.fill(field_pt(ctx, 0));
+    for (size_t i = 0; i < num_blocks; ++i) {
+        const field_pt is_last_block = field_pt::accumulate(is_end_in_block[i]);
+
+        std::array<field_pt, 16> hash_input;
+        for (size_t j = 0; j < 16; ++j) {
+            const size_t offset = i * bytes_per_block + j * 4;
+            hash_input[j] = field_pt::accumulate({ padded[offset] * fr(1 << 24),
+                                                   padded[offset + 1] * fr(1 << 16),
+                                                   padded[offset + 2] * fr(1 << 8),
+                                                   padded[offset + 3] });
+        }
+        // The length field is zero unless this is the last block (whose trailing bytes are zero padding).
+        hash_input[15] = is_last_block.madd(bit_length, hash_input[15]);
+
+        rolling_hash = sha256_block(rolling_hash, hash_input, false);
+        for (size_t j = 0; j < 8; ++j) {
+            digest[j] = is_last_block.madd(rolling_hash[j], digest[j]);
+        }
+    }
+
+    for (size_t j = 0; j < 8; ++j) {
+        digest[j].create_range_constraint(32);
+    }
+
+    std::vector<field_pt> output(digest.begin(), digest.end());
+    return packed_byte_array<Builder>(output, 4);
+}
+
 #define SHA256_PLOOKUP(circuit_type)                                                                                   \
     packed_byte_array<circuit_type> sha256(const packed_byte_array<circuit_type>& input)
+#define SHA256_PLOOKUP_VAR(circuit_type)                                                                               \
+    packed_byte_array<circuit_type> sha256_var(const byte_array<circuit_type>& input,                                 \
+                                               const field_t<circuit_type>& num_bytes)
 
 INSTANTIATE_STDLIB_ULTRA_METHOD(SHA256_PLOOKUP)
+INSTANTIATE_STDLIB_ULTRA_METHOD(SHA256_PLOOKUP_VAR)
 } // namespace sha256_plookup
 } // namespace stdlib
 } // namespace proof_system::plonk
@@ -6,6 +6,7 @@
 #include "barretenberg/numeric/bitop/sparse_form.hpp"
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 
+#include "../../primitives/byte_array/byte_array.hpp"
 #include "../../primitives/field/field.hpp"
 #include "../../primitives/packed_byte_array/packed_byte_array.hpp"
 
@@ -83,9 +84,13 @@ field_t<Builder> majority(sparse_value<Builder>& a, const sparse_value<Builder>&
 
 template <typename Builder>
 std::array<field_t<Builder>, 8> sha256_block(const std::array<field_t<Builder>, 8>& h_init,
-                                             const std::array<field_t<Builder>, 16>& input);
+                                             const std::array<field_t<Builder>, 16>& input,
+                                             bool range_constrain_all_outputs = true);
 
 template <typename Builder> packed_byte_array<Builder> sha256(const packed_byte_array<Builder>& input);
+
+template <typename Builder>
+packed_byte_array<Builder> sha256_var(const byte_array<Builder>& input, const field_t<Builder>& num_bytes);
 } // namespace sha256_plookup
 } // namespace stdlib
 } // namespace proof_system::plonk
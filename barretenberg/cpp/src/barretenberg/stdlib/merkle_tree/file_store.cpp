@@ -0,0 +1,440 @@
+#include "file_store.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+namespace {
+
+/**
+ * Log layout:
+ *   header:  LOG_MAGIC (8 bytes)
+ *   batch:   [BATCH_MAGIC: u32][num_records: u32][payload_size: u64][payload][checksum(payload): u64]
+ *   record:  [op: u8][key_size: u8][key][value_size: u32][value]   (value_size and value only for puts)
+ * All integers are big-endian, as written by `serialize::write`.
+ */
+constexpr std::array<uint8_t, 8> LOG_MAGIC = { 'B', 'B', 'M', 'T', 'L', 'O', 'G', '1' };
+constexpr uint32_t BATCH_MAGIC = 0x62617463;
+constexpr size_t BATCH_HEADER_SIZE = 16;
+constexpr size_t BATCH_FOOTER_SIZE = 8;
+constexpr uint8_t OP_DEL = 0;
+constexpr uint8_t OP_PUT = 1;
+// Bound on the number of records written per batch by `compact`, to bound its memory use.
+constexpr size_t MAX_COMPACT_BATCH_RECORDS = 1 << 16;
+
+// FNV-1a. Only used to detect torn or partially written batches, not for security.
+uint64_t checksum(uint8_t const* data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void write_fully(int fd, uint8_t const* data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        auto written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            throw_or_abort(std::string("FileStore: write failed: ") + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+
+// Returns false if the file ends before `size` bytes could be read.
+bool read_fully(int fd, uint8_t* data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        auto read = ::pread(fd, data, size, static_cast<off_t>(offset));
+        if (read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read < 0) {
+            throw_or_abort(std::string("FileStore: read failed: ") + std::strerror(errno));
+        }
+        if (read == 0) {
+            return false;
+        }
+        data += read;
+        size -= static_cast<size_t>(read);
+        offset += static_cast<uint64_t>(read);
+    }
+    return true;
+}
+
+void sync(int fd)
+{
+    if (::fsync(fd) != 0) {
+        throw_or_abort(std::string("FileStore: fsync failed: ") + std::strerror(errno));
+    }
+}
+
+/**
+ * Makes a rename or creation of `path` durable by syncing the directory entry that names it.
+ */
+void sync_parent_directory(std::string const& path)
+{
+    auto dir = std::filesystem::path(path).parent_path();
+    if (dir.empty()) {
+        dir = ".";
+    }
+    int dir_fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (dir_fd < 0) {
+        throw_or_abort("FileStore: unable to open directory " + dir.string() + ": " + std::strerror(errno));
+    }
+    const int result = ::fsync(dir_fd);
+    const int fsync_errno = errno;
+    ::close(dir_fd);
+    if (result != 0) {
+        throw_or_abort("FileStore: unable to sync directory " + dir.string() + ": " + std::strerror(fsync_errno));
+    }
+}
+
+/**
+ * Accumulates records into a batch, tracking where each put value will land in the file.
+ */
+struct BatchWriter {
+    uint64_t batch_offset;
+    uint32_t num_records = 0;
+    std::vector<uint8_t> payload;
+
+    BatchWriter(uint64_t offset)
+        : batch_offset(offset)
+    {}
+
+    // Returns the file offset of the value.
+    uint64_t add_put(FileStore::Key const& key, std::vector<uint8_t> const& value)
+    {
+        using serialize::write;
+        write(payload, OP_PUT);
+        write(payload, key.size);
+        payload.insert(payload.end(), key.data.begin(), key.data.begin() + key.size);
+        write(payload, static_cast<uint32_t>(value.size()));
+        uint64_t value_offset = batch_offset + BATCH_HEADER_SIZE + payload.size();
+        payload.insert(payload.end(), value.begin(), value.end());
+        ++num_records;
+        return value_offset;
+    }
+
+    void add_del(FileStore::Key const& key)
+    {
+        using serialize::write;
+        write(payload, OP_DEL);
+        write(payload, key.size);
+        payload.insert(payload.end(), key.data.begin(), key.data.begin() + key.size);
+        ++num_records;
+    }
+
+    std::vector<uint8_t> finalize() const
+    {
+        using serialize::write;
+        std::vector<uint8_t> buf;
+        buf.reserve(BATCH_HEADER_SIZE + payload.size() + BATCH_FOOTER_SIZE);
+        write(buf, BATCH_MAGIC);
+        write(buf, num_records);
+        write(buf, static_cast<uint64_t>(payload.size()));
+        buf.insert(buf.end(), payload.begin(), payload.end());
+        write(buf, checksum(payload.data(), payload.size()));
+        return buf;
+    }
+};
+
+} // namespace
+
+FileStore::Key::Key(std::vector<uint8_t> const& key)
+    : size(static_cast<uint8_t>(key.size()))
+{
+    if (key.size() > MAX_KEY_SIZE) {
+        throw_or_abort("FileStore: key of " + std::to_string(key.size()) + " bytes exceeds the maximum of " +
+                       std::to_string(MAX_KEY_SIZE));
+    }
+    std::copy(key.begin(), key.end(), data.begin());
+}
+
+FileStore::FileStore(std::string const& path, size_t cache_size)
+    : path_(path)
+    , cache_size_(cache_size)
+{
+    open_log();
+    replay_log();
+}
+
+FileStore::~FileStore()
+{
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void FileStore::open_log()
+{
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        throw_or_abort("FileStore: unable to open " + path_ + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        throw_or_abort("FileStore: unable to stat " + path_ + ": " + std::strerror(errno));
+    }
+    file_size_ = static_cast<uint64_t>(st.st_size);
+
+    if (file_size_ < LOG_MAGIC.size()) {
+        // New (or torn before the header was synced) log.
+        write_fully(fd_, LOG_MAGIC.data(), LOG_MAGIC.size(), 0);
+        file_size_ = LOG_MAGIC.size();
+        if (::ftruncate(fd_, static_cast<off_t>(file_size_)) != 0) {
+            throw_or_abort("FileStore: unable to truncate " + path_ + ": " + std::strerror(errno));
+        }
+        sync(fd_);
+        return;
+    }
+    std::array<uint8_t, LOG_MAGIC.size()> magic;
+    read_fully(fd_, magic.data(), magic.size(), 0);
+    if (magic != LOG_MAGIC) {
+        throw_or_abort("FileStore: " + path_ + " is not a merkle tree log");
+    }
+}
+
+void FileStore::replay_log()
+{
+    using serialize::read;
+    uint64_t offset = LOG_MAGIC.size();
+    std::vector<uint8_t> payload;
+
+    while (offset < file_size_) {
+        std::array<uint8_t, BATCH_HEADER_SIZE> header;
+        if (!read_fully(fd_, header.data(), header.size(), offset)) {
+            break;
+        }
+        uint8_t const* it = header.data();
+        uint32_t magic = 0;
+        uint32_t num_records = 0;
+        uint64_t payload_size = 0;
+        read(it, magic);
+        read(it, num_records);
+        read(it, payload_size);
+        if (magic != BATCH_MAGIC ||
+            offset + BATCH_HEADER_SIZE + payload_size + BATCH_FOOTER_SIZE > file_size_) {
+            break;
+        }
+
+        payload.resize(payload_size + BATCH_FOOTER_SIZE);
+        if (!read_fully(fd_, payload.data(), payload.size(), offset + BATCH_HEADER_SIZE)) {
+            break;
+        }
+        uint64_t expected_checksum = 0;
+        it = payload.data() + payload_size;
+        read(it, expected_checksum);
+        if (checksum(payload.data(), payload_size) != expected_checksum) {
+            break;
+        }
+
+        // The batch is complete, apply it.
+        it = payload.data();
+        for (uint32_t i = 0; i < num_records; ++i) {
+            uint8_t op = 0;
+            Key key;
+            read(it, op);
+            read(it, key.size);
+            std::copy(it, it + key.size, key.data.begin());
+            it += key.size;
+            if (op == OP_PUT) {
+                uint32_t value_size = 0;
+                read(it, value_size);
+                uint64_t value_offset = offset + BATCH_HEADER_SIZE + static_cast<uint64_t>(it - payload.data());
+                index_[key] = { value_offset, value_size };
+                it += value_size;
+            } else {
+                index_.erase(key);
+            }
+        }
+        offset += BATCH_HEADER_SIZE + payload_size + BATCH_FOOTER_SIZE;
+    }
+
+    if (offset != file_size_) {
+        // Discard the torn batch left behind by a crash during `commit`, so that new batches follow the valid ones.
+        if (::ftruncate(fd_, static_cast<off_t>(offset)) != 0) {
+            throw_or_abort("FileStore: unable to truncate " + path_ + ": " + std::strerror(errno));
+        }
+        sync(fd_);
+        file_size_ = offset;
+    }
+}
+
+void FileStore::append(std::vector<uint8_t> const& buf)
+{
+    write_fully(fd_, buf.data(), buf.size(), file_size_);
+    file_size_ += buf.size();
+}
+
+std::vector<uint8_t> FileStore::read_at(Location const& location) const
+{
+    std::vector<uint8_t> value(location.size);
+    if (!read_fully(fd_, value.data(), value.size(), location.offset)) {
+        throw_or_abort("FileStore: unexpected end of file in " + path_);
+    }
+    return value;
+}
+
+bool FileStore::put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+{
+    Key k(key);
+    puts_[k] = value;
+    deletes_.erase(k);
+    return true;
+}
+
+bool FileStore::del(std::vector<uint8_t> const& key)
+{
+    Key k(key);
+    puts_.erase(k);
+    deletes_.insert(k);
+    return true;
+}
+
+bool FileStore::get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value)
+{
+    Key k(key);
+    if (deletes_.contains(k)) {
+        return false;
+    }
+    if (auto it = puts_.find(k); it != puts_.end()) {
+        value = it->second;
+        return true;
+    }
+    if (auto it = cache_.find(k); it != cache_.end()) {
+        cache_order_.splice(cache_order_.begin(), cache_order_, it->second.second);
+        value = it->second.first;
+        return true;
+    }
+    auto it = index_.find(k);
+    if (it == index_.end()) {
+        return false;
+    }
+    value = read_at(it->second);
+    cache_insert(k, value);
+    return true;
+}
+
+void FileStore::commit()
+{
+    if (puts_.empty() && deletes_.empty()) {
+        return;
+    }
+
+    BatchWriter batch(file_size_);
+    std::vector<std::pair<Key, uint64_t>> locations;
+    locations.reserve(puts_.size());
+    for (auto const& key : deletes_) {
+        batch.add_del(key);
+    }
+    for (auto const& [key, value] : puts_) {
+        locations.emplace_back(key, batch.add_put(key, value));
+    }
+    append(batch.finalize());
+    sync(fd_);
+
+    // The batch is durable, make it visible.
+    for (auto const& key : deletes_) {
+        index_.erase(key);
+        cache_erase(key);
+    }
+    for (auto const& [key, value_offset] : locations) {
+        auto const& value = puts_[key];
+        index_[key] = { value_offset, static_cast<uint32_t>(value.size()) };
+        cache_insert(key, value);
+    }
+    puts_.clear();
+    deletes_.clear();
+}
+
+void FileStore::rollback()
+{
+    puts_.clear();
+    deletes_.clear();
+}
+
+void FileStore::compact()
+{
+    const std::string tmp_path = path_ + ".compact";
+    int tmp_fd = ::open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (tmp_fd < 0) {
+        throw_or_abort("FileStore: unable to open " + tmp_path + ": " + std::strerror(errno));
+    }
+    write_fully(tmp_fd, LOG_MAGIC.data(), LOG_MAGIC.size(), 0);
+    uint64_t tmp_size = LOG_MAGIC.size();
+
+    std::unordered_map<Key, Location, KeyHash> new_index;
+    new_index.reserve(index_.size());
+    auto it = index_.begin();
+    while (it != index_.end()) {
+        BatchWriter batch(tmp_size);
+        for (size_t i = 0; i < MAX_COMPACT_BATCH_RECORDS && it != index_.end(); ++i, ++it) {
+            new_index[it->first] = { batch.add_put(it->first, read_at(it->second)), it->second.size };
+        }
+        auto buf = batch.finalize();
+        write_fully(tmp_fd, buf.data(), buf.size(), tmp_size);
+        tmp_size += buf.size();
+    }
+    sync(tmp_fd);
+
+    if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        ::close(tmp_fd);
+        throw_or_abort("FileStore: unable to replace " + path_ + ": " + std::strerror(errno));
+    }
+    ::close(fd_);
+    fd_ = tmp_fd;
+    file_size_ = tmp_size;
+    index_ = std::move(new_index);
+    // Until the directory entry is synced, a crash can bring back the pre-compaction log.
+    sync_parent_directory(path_);
+}
+
+void FileStore::cache_insert(Key const& key, std::vector<uint8_t> const& value)
+{
+    if (cache_size_ == 0) {
+        return;
+    }
+    if (auto it = cache_.find(key); it != cache_.end()) {
+        it->second.first = value;
+        cache_order_.splice(cache_order_.begin(), cache_order_, it->second.second);
+        return;
+    }
+    if (cache_.size() >= cache_size_) {
+        cache_.erase(cache_order_.back());
+        cache_order_.pop_back();
+    }
+    cache_order_.push_front(key);
+    cache_.emplace(key, std::make_pair(value, cache_order_.begin()));
+}
+
+void FileStore::cache_erase(Key const& key)
+{
+    if (auto it = cache_.find(key); it != cache_.end()) {
+        cache_order_.erase(it->second.second);
+        cache_.erase(it);
+    }
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
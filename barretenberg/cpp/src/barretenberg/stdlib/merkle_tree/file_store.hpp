@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+/**
+ * A persistent key-value store for `MerkleTree`, backed by a single append-only log file.
+ *
+ * The interface matches `MemoryStore`: puts and deletes are buffered until `commit()` (e.g. once per block), which
+ * appends them to the log as one checksummed batch and syncs the file before making them visible. When the file is
+ * opened the log is replayed up to the last complete batch, so a batch torn by a crash is discarded as a whole.
+ *
+ * Only an index of key -> value location is held in memory; values are read from the file on demand. The most recently
+ * used values are cached, which keeps the nodes near the root (touched by every update and path query) in memory.
+ * `compact()` rewrites the log with only the live entries.
+ */
+class FileStore {
+  public:
+    // Merkle tree keys are a 32-byte node hash, a 1-byte tree id (metadata) or a tree id followed by a 32-byte index.
+    static constexpr size_t MAX_KEY_SIZE = 33;
+    static constexpr size_t DEFAULT_CACHE_SIZE = 1 << 16;
+
+    /**
+     * A fixed-size binary key. Avoids the heap allocated strings used by `MemoryStore`.
+     */
+    struct Key {
+        uint8_t size = 0;
+        std::array<uint8_t, MAX_KEY_SIZE> data{};
+
+        Key() = default;
+        Key(std::vector<uint8_t> const& key);
+
+        std::string_view view() const { return { reinterpret_cast<const char*>(data.data()), size }; }
+        bool operator==(Key const& other) const { return view() == other.view(); }
+    };
+
+    struct KeyHash {
+        size_t operator()(Key const& key) const { return std::hash<std::string_view>{}(key.view()); }
+    };
+
+    FileStore(std::string const& path, size_t cache_size = DEFAULT_CACHE_SIZE);
+    FileStore(FileStore const& rhs) = delete;
+    FileStore(FileStore&& rhs) = delete;
+    FileStore& operator=(FileStore const& rhs) = delete;
+    FileStore& operator=(FileStore&& rhs) = delete;
+    ~FileStore();
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value);
+
+    /**
+     * Durably appends all pending writes to the log as one batch.
+     */
+    void commit();
+
+    /**
+     * Discards all pending writes.
+     */
+    void rollback();
+
+    /**
+     * Rewrites the log so that it only contains the live entries, and atomically replaces the old log.
+     * Pending (uncommitted) writes are kept pending.
+     */
+    void compact();
+
+    size_t size() const { return index_.size(); }
+
+  private:
+    struct Location {
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    void open_log();
+    void replay_log();
+    void append(std::vector<uint8_t> const& buf);
+    std::vector<uint8_t> read_at(Location const& location) const;
+    void cache_insert(Key const& key, std::vector<uint8_t> const& value);
+    void cache_erase(Key const& key);
+
+    std::string path_;
+    int fd_ = -1;
+    uint64_t file_size_ = 0;
+
+    std::unordered_map<Key, Location, KeyHash> index_;
+    std::unordered_map<Key, std::vector<uint8_t>, KeyHash> puts_;
+    std::unordered_set<Key, KeyHash> deletes_;
+
+    // LRU value cache. Most recently used entries are at the front of cache_order_.
+    size_t cache_size_;
+    std::list<Key> cache_order_;
+    std::unordered_map<Key, std::pair<std::vector<uint8_t>, std::list<Key>::iterator>, KeyHash> cache_;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
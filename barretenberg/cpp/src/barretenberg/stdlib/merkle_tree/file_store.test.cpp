@@ -0,0 +1,167 @@
+#include "file_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "memory_tree.hpp"
+#include "merkle_tree.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+namespace proof_system::test_stdlib_merkle_tree {
+
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+/**
+ * A fresh directory under the system temp directory, removed with everything in it when the test ends.
+ */
+class TempDir {
+  public:
+    TempDir()
+    {
+        auto pattern = (std::filesystem::temp_directory_path() / "bb_file_store_XXXXXX").string();
+        if (mkdtemp(pattern.data()) == nullptr) {
+            throw std::runtime_error("unable to create a temp directory");
+        }
+        path_ = pattern;
+    }
+    TempDir(TempDir const&) = delete;
+    TempDir& operator=(TempDir const&) = delete;
+    ~TempDir() { std::filesystem::remove_all(path_); }
+
+    std::string file(std::string const& name) const { return (path_ / name).string(); }
+
+  private:
+    std::filesystem::path path_;
+};
+} // namespace
+
+TEST(stdlib_merkle_tree_file_store, put_get_del_commit_rollback)
+{
+    TempDir dir;
+    auto path = dir.file("file_store_basic.log");
+    std::vector<uint8_t> key_a = { 1, 2, 3 };
+    std::vector<uint8_t> key_b(FileStore::MAX_KEY_SIZE, 7);
+    std::vector<uint8_t> value;
+    {
+        FileStore store(path);
+        store.put(key_a, { 4, 5 });
+        store.put(key_b, { 6 });
+        EXPECT_TRUE(store.get(key_a, value));
+        EXPECT_EQ(value, std::vector<uint8_t>({ 4, 5 }));
+        store.commit();
+
+        store.del(key_a);
+        EXPECT_FALSE(store.get(key_a, value));
+        store.rollback();
+        EXPECT_TRUE(store.get(key_a, value));
+
+        store.del(key_b);
+        store.commit();
+        EXPECT_FALSE(store.get(key_b, value));
+
+        // Uncommitted writes are not persisted.
+        store.put(key_b, { 8 });
+    }
+    {
+        FileStore store(path);
+        EXPECT_EQ(store.size(), 1UL);
+        EXPECT_TRUE(store.get(key_a, value));
+        EXPECT_EQ(value, std::vector<uint8_t>({ 4, 5 }));
+        EXPECT_FALSE(store.get(key_b, value));
+    }
+}
+
+TEST(stdlib_merkle_tree_file_store, rejects_oversized_key)
+{
+    TempDir dir;
+    FileStore store(dir.file("file_store_key.log"));
+    std::vector<uint8_t> key(FileStore::MAX_KEY_SIZE + 1, 7);
+    EXPECT_THROW(store.put(key, { 1 }), std::runtime_error);
+    EXPECT_EQ(store.size(), 0UL);
+}
+
+TEST(stdlib_merkle_tree_file_store, tree_survives_reopen)
+{
+    constexpr size_t depth = 10;
+    TempDir dir;
+    auto path = dir.file("file_store_tree.log");
+    MemoryTree memdb(depth);
+    fr root;
+    {
+        // A tiny cache forces reads to go to the file.
+        FileStore store(path, 4);
+        MerkleTree db(store, depth);
+        for (size_t block = 0; block < 4; ++block) {
+            for (size_t i = 0; i < 32; ++i) {
+                size_t index = engine.get_random_uint32() % (1UL << depth);
+                fr value = fr::random_element();
+                memdb.update_element(index, value);
+                db.update_element(index, value);
+            }
+            store.commit();
+        }
+        root = db.root();
+        EXPECT_EQ(root, memdb.root());
+    }
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        EXPECT_EQ(db.root(), root);
+        EXPECT_EQ(db.get_hash_path(0), memdb.get_hash_path(0));
+        EXPECT_EQ(db.get_hash_path(1000), memdb.get_hash_path(1000));
+
+        store.compact();
+        EXPECT_EQ(db.root(), root);
+        EXPECT_EQ(db.get_sibling_path(513), memdb.get_sibling_path(513));
+    }
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        EXPECT_EQ(db.root(), root);
+    }
+}
+
+TEST(stdlib_merkle_tree_file_store, torn_batch_is_discarded)
+{
+    constexpr size_t depth = 8;
+    TempDir dir;
+    auto path = dir.file("file_store_torn.log");
+    fr root;
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        db.update_element(3, fr(5));
+        store.commit();
+        root = db.root();
+        db.update_element(4, fr(6));
+        store.commit();
+    }
+    {
+        // Simulate a crash half way through writing the second batch.
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        auto size = static_cast<size_t>(in.tellg());
+        in.close();
+        ASSERT_EQ(truncate(path.c_str(), static_cast<off_t>(size - 10)), 0);
+    }
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        EXPECT_EQ(db.root(), root);
+
+        // The log is usable after recovery.
+        db.update_element(4, fr(7));
+        store.commit();
+        root = db.root();
+    }
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        EXPECT_EQ(db.root(), root);
+    }
+}
+
+} // namespace proof_system::test_stdlib_merkle_tree
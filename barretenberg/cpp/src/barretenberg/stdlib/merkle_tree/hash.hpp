@@ -1,8 +1,10 @@
 #pragma once
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
@@ -20,6 +22,41 @@ inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
     return crypto::pedersen_hash::hash(inputs); // uses lookup tables
 }
 
+/**
+ * Node hash functions for `MerkleTree`.
+ * `hash_pairs` hashes a whole layer of independent nodes, and is where a hash function can batch its work.
+ */
+struct PedersenHashPolicy {
+    static barretenberg::fr hash_pair(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
+    {
+        return hash_pair_native(lhs, rhs);
+    }
+
+    static std::vector<barretenberg::fr> hash_pairs(std::span<const barretenberg::fr> lhs,
+                                                    std::span<const barretenberg::fr> rhs)
+    {
+        std::vector<barretenberg::fr> result(lhs.size());
+        parallel_for(lhs.size(), [&](size_t i) { result[i] = hash_pair_native(lhs[i], rhs[i]); });
+        return result;
+    }
+};
+
+struct Poseidon2HashPolicy {
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static barretenberg::fr hash_pair(barretenberg::fr const& lhs, barretenberg::fr const& rhs)
+    {
+        std::array<barretenberg::fr, 2> input{ lhs, rhs };
+        return Poseidon2::hash(input);
+    }
+
+    static std::vector<barretenberg::fr> hash_pairs(std::span<const barretenberg::fr> lhs,
+                                                    std::span<const barretenberg::fr> rhs)
+    {
+        return Poseidon2::hash_pairs(lhs, rhs);
+    }
+};
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
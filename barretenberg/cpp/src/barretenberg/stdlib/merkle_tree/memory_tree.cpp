@@ -1,4 +1,5 @@
 #include "memory_tree.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "hash.hpp"
 
 namespace proof_system::plonk {
@@ -76,6 +77,60 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+fr MemoryTree::update_elements(std::vector<std::pair<size_t, fr>> const& updates)
+{
+    if (updates.empty()) {
+        return root_;
+    }
+
+    // Write the leaves in order (so later duplicates overwrite earlier ones) and collect the dirty parents.
+    std::vector<size_t> dirty;
+    dirty.reserve(updates.size());
+    for (auto const& [index, value] : updates) {
+        ASSERT(index < total_size_);
+        hashes_[index] = value;
+        dirty.emplace_back(index >> 1);
+    }
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+    size_t child_offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_; ++i) {
+        const size_t offset = child_offset + layer_size;
+        // The root is not stored in hashes_, it lives in root_.
+        const bool is_root = (i == depth_ - 1);
+        parallel_for(dirty.size(), [&](size_t j) {
+            const size_t parent = dirty[j];
+            const fr parent_hash =
+                hash_pair_native(hashes_[child_offset + 2 * parent], hashes_[child_offset + 2 * parent + 1]);
+            if (is_root) {
+                root_ = parent_hash;
+            } else {
+                hashes_[offset + parent] = parent_hash;
+            }
+        });
+        // dirty is sorted, so the parents of the next layer are too and only adjacent duplicates need removing.
+        for (auto& parent : dirty) {
+            parent >>= 1;
+        }
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+        child_offset = offset;
+        layer_size >>= 1;
+    }
+    return root_;
+}
+
+fr MemoryTree::update_elements(size_t start_index, std::vector<fr> const& values)
+{
+    std::vector<std::pair<size_t, fr>> updates;
+    updates.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        updates.emplace_back(start_index + i, values[i]);
+    }
+    return update_elements(updates);
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
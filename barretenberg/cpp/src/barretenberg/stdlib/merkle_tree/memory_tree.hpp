@@ -34,6 +34,18 @@ class MemoryTree {
 
     fr update_element(size_t index, fr const& value);
 
+    /**
+     * Writes a batch of leaves and recomputes the root in a single bottom-up sweep.
+     * Ancestors shared by several updated leaves are hashed once, and each layer is hashed in parallel.
+     * If an index appears more than once, the last value in `updates` wins (as if applied sequentially).
+     */
+    fr update_elements(std::vector<std::pair<size_t, fr>> const& updates);
+
+    /**
+     * Writes `values` to the contiguous leaf range starting at `start_index`.
+     */
+    fr update_elements(size_t start_index, std::vector<fr> const& values);
+
     fr root() const { return root_; }
 
   public:
@@ -78,3 +78,25 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_store_update_elements)
+{
+    constexpr size_t depth = 8;
+    MemoryTree db(depth);
+    MemoryTree batch_db(depth);
+
+    std::vector<std::pair<size_t, fr>> updates;
+    for (size_t i = 0; i < 100; ++i) {
+        updates.emplace_back((i * 37) % (1UL << depth), fr::random_element());
+    }
+    // Later writes to the same index win.
+    updates.emplace_back(updates[0].first, VALUES[3]);
+
+    for (auto const& [index, value] : updates) {
+        db.update_element(index, value);
+    }
+    batch_db.update_elements(updates);
+
+    EXPECT_EQ(batch_db.root(), db.root());
+    EXPECT_EQ(batch_db.hashes_, db.hashes_);
+}
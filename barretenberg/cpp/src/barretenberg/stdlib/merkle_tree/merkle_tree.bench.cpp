@@ -2,6 +2,7 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -55,6 +56,44 @@ void update_elements(State& state) noexcept
 }
 BENCHMARK(update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
 
+void update_elements_batched(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryStore store;
+        MerkleTree<MemoryStore> db(store, DEPTH);
+        std::vector<fr> values(VALUES.begin(), VALUES.begin() + state.range(0));
+        state.ResumeTiming();
+        db.update_elements(0, values);
+    }
+}
+BENCHMARK(update_elements_batched)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+
+void memory_tree_update_elements(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryTree db(20);
+        state.ResumeTiming();
+        for (size_t i = 0; i < (size_t)state.range(0); ++i) {
+            db.update_element(i, VALUES[i]);
+        }
+    }
+}
+BENCHMARK(memory_tree_update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+
+void memory_tree_update_elements_batched(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryTree db(20);
+        std::vector<fr> values(VALUES.begin(), VALUES.begin() + state.range(0));
+        state.ResumeTiming();
+        db.update_elements(0, values);
+    }
+}
+BENCHMARK(memory_tree_update_elements_batched)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+
 void update_random_elements(State& state) noexcept
 {
     for (auto _ : state) {
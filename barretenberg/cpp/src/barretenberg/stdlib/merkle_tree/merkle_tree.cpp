@@ -1,11 +1,14 @@
 #include "merkle_tree.hpp"
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/count_leading_zeros.hpp"
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 namespace proof_system::plonk {
@@ -23,8 +26,8 @@ template <typename T> inline bool bit_set(T const& index, size_t i)
     return bool((index >> i) & 0x1);
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     : store_(store)
     , depth_(depth)
     , tree_id_(tree_id)
@@ -36,29 +39,30 @@ MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     auto current = fr(0);
     for (size_t i = 0; i < depth; ++i) {
         zero_hashes_[i] = current;
-        current = hash_pair_native(current, current);
+        current = HashingPolicy::hash_pair(current, current);
     }
 }
 
-template <typename Store>
-MerkleTree<Store>::MerkleTree(MerkleTree&& other)
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(MerkleTree&& other)
     : store_(other.store_)
     , zero_hashes_(std::move(other.zero_hashes_))
     , depth_(other.depth_)
     , tree_id_(other.tree_id_)
 {}
 
-template <typename Store> MerkleTree<Store>::~MerkleTree() {}
+template <typename Store, typename HashingPolicy> MerkleTree<Store, HashingPolicy>::~MerkleTree() {}
 
-template <typename Store> fr MerkleTree<Store>::root() const
+template <typename Store, typename HashingPolicy> fr MerkleTree<Store, HashingPolicy>::root() const
 {
     std::vector<uint8_t> root;
     std::vector<uint8_t> key = { tree_id_ };
     bool status = store_.get(key, root);
-    return status ? from_buffer<fr>(root) : hash_pair_native(zero_hashes_.back(), zero_hashes_.back());
+    return status ? from_buffer<fr>(root) : HashingPolicy::hash_pair(zero_hashes_.back(), zero_hashes_.back());
 }
 
-template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>::size() const
+template <typename Store, typename HashingPolicy>
+typename MerkleTree<Store, HashingPolicy>::index_t MerkleTree<Store, HashingPolicy>::size() const
 {
     std::vector<uint8_t> size_buf;
     std::vector<uint8_t> key = { tree_id_ };
@@ -66,7 +70,8 @@ template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>:
     return status ? from_buffer<index_t>(size_buf, 32) : 0;
 }
 
-template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_hash_path MerkleTree<Store, HashingPolicy>::get_hash_path(index_t index)
 {
     fr_hash_path path(depth_);
 
@@ -107,7 +112,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             } else {
                 // Requesting path to a different, independent element.
@@ -127,7 +132,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
                     } else {
                         path[j] = std::make_pair(current, zero_hashes_[j]);
                     }
-                    current = hash_pair_native(path[j].first, path[j].second);
+                    current = HashingPolicy::hash_pair(path[j].first, path[j].second);
                 }
             }
             break;
@@ -137,7 +142,8 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
     return path;
 }
 
-template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(index_t index)
+template <typename Store, typename HashingPolicy>
+fr_sibling_path MerkleTree<Store, HashingPolicy>::get_sibling_path(index_t index)
 {
     fr_sibling_path path(depth_);
 
@@ -196,7 +202,8 @@ template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(in
     return path;
 }
 
-template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(index_t index, fr const& value)
 {
     auto leaf = value;
     using serialize::write;
@@ -216,18 +223,208 @@ template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr
     return r;
 }
 
-template <typename Store> fr MerkleTree<Store>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_elements(std::vector<std::pair<index_t, fr>> const& updates)
+{
+    if (updates.empty()) {
+        return root();
+    }
+
+    using serialize::write;
+    for (auto const& [index, value] : updates) {
+        std::vector<uint8_t> leaf_key;
+        write(leaf_key, tree_id_);
+        write(leaf_key, index);
+        store_.put(leaf_key, to_buffer(value));
+    }
+
+    // Sort by index, keeping only the last value written to each index. The positions are sorted rather than the
+    // updates themselves, as std::stable_sort's temporary buffer does not respect the alignment of fr.
+    std::vector<size_t> order(updates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return updates[a].first < updates[b].first || (updates[a].first == updates[b].first && a < b);
+    });
+    std::vector<std::pair<index_t, fr>> sorted_updates;
+    sorted_updates.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (i + 1 < order.size() && updates[order[i + 1]].first == updates[order[i]].first) {
+            continue;
+        }
+        sorted_updates.emplace_back(updates[order[i]]);
+    }
+
+    // Walk the existing tree once to find every node that has to be rehashed.
+    PendingLayers layers(depth_ + 1);
+    auto [root_hash, root_node] = plan_update_elements(root(), false, sorted_updates, depth_, layers);
+
+    // Hash bottom-up. Nodes within a layer are independent of each other, so the regular nodes of a layer are hashed
+    // with a single call to HashingPolicy::hash_pairs.
+    for (size_t height = 1; height <= depth_; ++height) {
+        auto& layer = layers[height];
+        auto const& children = layers[height - 1];
+        std::vector<size_t> regular_nodes;
+        for (size_t i = 0; i < layer.size(); ++i) {
+            if (!layer[i].is_stump) {
+                regular_nodes.push_back(i);
+            }
+        }
+        std::vector<fr> lefts(regular_nodes.size());
+        std::vector<fr> rights(regular_nodes.size());
+        parallel_for(regular_nodes.size(), [&](size_t i) {
+            auto& node = layer[regular_nodes[i]];
+            if (node.left_child != PendingNode::NO_CHILD) {
+                node.left = children[node.left_child].hash;
+            }
+            if (node.right_child != PendingNode::NO_CHILD) {
+                node.right = children[node.right_child].hash;
+            }
+            lefts[i] = node.left;
+            rights[i] = node.right;
+        });
+        auto hashes = HashingPolicy::hash_pairs(lefts, rights);
+        for (size_t i = 0; i < regular_nodes.size(); ++i) {
+            layer[regular_nodes[i]].hash = hashes[i];
+        }
+        parallel_for(layer.size(), [&](size_t i) {
+            auto& node = layer[i];
+            if (node.is_stump) {
+                node.hash = compute_zero_path_hash(height, node.stump_index, node.stump_value);
+            }
+        });
+    }
+    fr r = root_node == PendingNode::NO_CHILD ? root_hash : layers[depth_][root_node].hash;
+
+    // Apply the writes. Removals go first so that a removed key that is recreated by this batch survives.
+    for (auto const& layer : layers) {
+        for (auto const& node : layer) {
+            if (node.old_left.has_value() && node.old_left.value() != node.left) {
+                remove(node.old_left.value());
+            }
+            if (node.old_right.has_value() && node.old_right.value() != node.right) {
+                remove(node.old_right.value());
+            }
+        }
+    }
+    for (auto const& layer : layers) {
+        for (auto const& node : layer) {
+            if (node.is_stump) {
+                put_stump(node.hash, node.stump_index, node.stump_value);
+            } else {
+                put(node.hash, node.left, node.right);
+            }
+        }
+    }
+
+    std::vector<uint8_t> meta_key = { tree_id_ };
+    std::vector<uint8_t> meta_buf;
+    write(meta_buf, r);
+    write(meta_buf, updates.back().first + 1);
+    store_.put(meta_key, meta_buf);
+
+    return r;
+}
+
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_elements(index_t start_index, std::vector<fr> const& values)
+{
+    std::vector<std::pair<index_t, fr>> updates;
+    updates.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        updates.emplace_back(start_index + i, values[i]);
+    }
+    return update_elements(updates);
+}
+
+template <typename Store, typename HashingPolicy>
+typename MerkleTree<Store, HashingPolicy>::PendingChild MerkleTree<Store, HashingPolicy>::plan_update_elements(
+    fr const& root, bool is_empty, std::span<std::pair<index_t, fr>> updates, size_t height, PendingLayers& layers)
+{
+    // Base layer of recursion at height = 0. Updates are unique, so there is exactly one.
+    if (height == 0) {
+        return { updates.back().second, PendingNode::NO_CHILD };
+    }
+
+    std::vector<uint8_t> data;
+    bool status = !is_empty && store_.get(root.to_buffer(), data);
+
+    // A stump is rebuilt as an empty subtree holding its element plus the updates.
+    std::vector<std::pair<index_t, fr>> merged_updates;
+    if (status && data.size() == STUMP_NODE_SIZE) {
+        index_t existing_index = from_buffer<index_t>(data, 32);
+        auto it = std::lower_bound(updates.begin(), updates.end(), existing_index, [](auto const& a, auto const& b) {
+            return a.first < b;
+        });
+        if (it == updates.end() || it->first != existing_index) {
+            merged_updates.reserve(updates.size() + 1);
+            merged_updates.insert(merged_updates.end(), updates.begin(), it);
+            merged_updates.emplace_back(existing_index, from_buffer<fr>(data, 0));
+            merged_updates.insert(merged_updates.end(), it, updates.end());
+            updates = merged_updates;
+        }
+        status = false;
+    }
+
+    auto& layer = layers[height];
+    PendingNode node;
+    if (!status && updates.size() == 1) {
+        node.is_stump = true;
+        node.stump_index = updates[0].first;
+        node.stump_value = updates[0].second;
+        layer.emplace_back(node);
+        return { fr(0), layer.size() - 1 };
+    }
+
+    // If its not a stump or empty, the data size must be 64 bytes.
+    ASSERT(!status || data.size() == REGULAR_NODE_SIZE);
+    node.left = status ? from_buffer<fr>(data, 0) : zero_hashes_[height - 1];
+    node.right = status ? from_buffer<fr>(data, 32) : zero_hashes_[height - 1];
+
+    // Updates are sorted, so the ones in the right subtree are a suffix.
+    for (auto& update : updates) {
+        update.first = numeric::keep_n_lsb(update.first, height);
+    }
+    auto split = std::partition_point(
+        updates.begin(), updates.end(), [&](auto const& update) { return !bit_set(update.first, height - 1); });
+    auto left_updates = updates.subspan(0, static_cast<size_t>(split - updates.begin()));
+    auto right_updates = updates.subspan(left_updates.size());
+    for (auto& update : right_updates) {
+        update.first = numeric::keep_n_lsb(update.first, height - 1);
+    }
+
+    if (!left_updates.empty()) {
+        if (status) {
+            node.old_left = node.left;
+        }
+        auto [hash, index] = plan_update_elements(node.left, !status, left_updates, height - 1, layers);
+        node.left = hash;
+        node.left_child = index;
+    }
+    if (!right_updates.empty()) {
+        if (status) {
+            node.old_right = node.right;
+        }
+        auto [hash, index] = plan_update_elements(node.right, !status, right_updates, height - 1, layers);
+        node.right = hash;
+        node.right_child = index;
+    }
+    layer.emplace_back(node);
+    return { fr(0), layer.size() - 1 };
+}
+
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
 {
     bool a_is_right = bit_set(a_index, height - 1);
     auto left = a_is_right ? b : a;
     auto right = a_is_right ? a : b;
-    auto key = hash_pair_native(left, right);
+    auto key = HashingPolicy::hash_pair(left, right);
     put(key, left, right);
     return key;
 }
 
-template <typename Store>
-fr MerkleTree<Store>::fork_stump(
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::fork_stump(
     fr const& value1, index_t index1, fr const& value2, index_t index2, size_t height, size_t common_height)
 {
     if (height == common_height) {
@@ -252,8 +449,8 @@ fr MerkleTree<Store>::fork_stump(
     }
 }
 
-template <typename Store>
-fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t index, size_t height)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::update_element(fr const& root, fr const& value, index_t index, size_t height)
 {
     // Base layer of recursion at height = 0.
     if (height == 0) {
@@ -299,7 +496,7 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
         } else {
             left = subtree_root;
         }
-        auto new_root = hash_pair_native(left, right);
+        auto new_root = HashingPolicy::hash_pair(left, right);
         put(new_root, left, right);
 
         // Remove the old node only while rolling back in recursion.
@@ -310,7 +507,8 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
     }
 }
 
-template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+fr MerkleTree<Store, HashingPolicy>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
 {
     fr current = value;
     for (size_t i = 0; i < height; ++i) {
@@ -323,12 +521,13 @@ template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t he
             right = zero_hashes_[i];
             left = current;
         }
-        current = hash_pair_native(left, right);
+        current = HashingPolicy::hash_pair(left, right);
     }
     return current;
 }
 
-template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& left, fr const& right)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put(fr const& key, fr const& left, fr const& right)
 {
     std::vector<uint8_t> value;
     write(value, left);
@@ -336,7 +535,8 @@ template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& l
     store_.put(key.to_buffer(), value);
 }
 
-template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index_t index, fr const& value)
+template <typename Store, typename HashingPolicy>
+void MerkleTree<Store, HashingPolicy>::put_stump(fr const& key, index_t index, fr const& value)
 {
     std::vector<uint8_t> buf;
     write(buf, value);
@@ -346,12 +546,14 @@ template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index
     store_.put(key.to_buffer(), buf);
 }
 
-template <typename Store> void MerkleTree<Store>::remove(fr const& key)
+template <typename Store, typename HashingPolicy> void MerkleTree<Store, HashingPolicy>::remove(fr const& key)
 {
     store_.del(key.to_buffer());
 }
 
 template class MerkleTree<MemoryStore>;
+template class MerkleTree<FileStore>;
+template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
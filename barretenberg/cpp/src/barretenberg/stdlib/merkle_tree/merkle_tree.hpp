@@ -1,6 +1,9 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "hash.hpp"
 #include "hash_path.hpp"
+#include <optional>
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -9,8 +12,13 @@ namespace merkle_tree {
 using namespace barretenberg;
 
 class MemoryStore;
+class FileStore;
 
-template <typename Store> class MerkleTree {
+/**
+ * A sparse Merkle tree whose nodes are kept in a key-value `Store`.
+ * Nodes are hashed with `HashingPolicy` (see hash.hpp); trees built with different policies have different roots.
+ */
+template <typename Store, typename HashingPolicy = PedersenHashPolicy> class MerkleTree {
   public:
     typedef uint256_t index_t;
 
@@ -25,6 +33,21 @@ template <typename Store> class MerkleTree {
 
     fr update_element(index_t index, fr const& value);
 
+    /**
+     * Updates a batch of leaves and returns the new root.
+     *
+     * The tree is descended once for the whole batch, so ancestors shared by several leaves are read, hashed and
+     * written once. Hashing is done bottom-up one layer at a time, with the nodes of each layer hashed in parallel.
+     * The resulting tree (and the contents of the store) are identical to applying `update_element` to each entry in
+     * order; in particular, if an index appears more than once the last value wins.
+     */
+    fr update_elements(std::vector<std::pair<index_t, fr>> const& updates);
+
+    /**
+     * Updates the contiguous range of leaves starting at `start_index` with `values`.
+     */
+    fr update_elements(index_t start_index, std::vector<fr> const& values);
+
     fr root() const;
 
     size_t depth() const { return depth_; }
@@ -32,8 +55,42 @@ template <typename Store> class MerkleTree {
     index_t size() const;
 
   protected:
+    /**
+     * A node whose hash is to be (re)computed by `update_elements`.
+     * Children are either already known hashes, or the index of a pending node in the layer below.
+     */
+    struct PendingNode {
+        static constexpr size_t NO_CHILD = static_cast<size_t>(-1);
+
+        bool is_stump = false;
+        // Regular node fields
+        fr left;
+        fr right;
+        size_t left_child = NO_CHILD;
+        size_t right_child = NO_CHILD;
+        // Previous children, removed from the store if they are replaced
+        std::optional<fr> old_left;
+        std::optional<fr> old_right;
+        // Stump fields
+        index_t stump_index;
+        fr stump_value;
+        // Output
+        fr hash;
+    };
+
+    using PendingLayers = std::vector<std::vector<PendingNode>>;
+    using PendingChild = std::pair<fr, size_t>;
+
     void load_metadata();
 
+    /**
+     * Descends the subtree rooted at `root` of `height` and records in `layers` every node that must be rehashed to
+     * insert the (sorted, unique) `updates`. Only reads from the store.
+     * Returns the subtree root: either a known hash, or the index of a pending node in `layers[height]`.
+     */
+    PendingChild plan_update_elements(
+        fr const& root, bool is_empty, std::span<std::pair<index_t, fr>> updates, size_t height, PendingLayers& layers);
+
     /**
      * Computes the root hash of a tree of `height`, that is empty other than `value` at `index`.
      *
@@ -98,6 +155,8 @@ template <typename Store> class MerkleTree {
 };
 
 extern template class MerkleTree<MemoryStore>;
+extern template class MerkleTree<FileStore>;
+extern template class MerkleTree<MemoryStore, Poseidon2HashPolicy>;
 
 } // namespace merkle_tree
 } // namespace stdlib
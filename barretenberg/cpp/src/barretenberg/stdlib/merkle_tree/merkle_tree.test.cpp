@@ -184,4 +184,95 @@ TEST(stdlib_merkle_tree, test_get_sibling_path_layers)
         EXPECT_NE(before[2], after[2]);
     }
 }
-} // namespace proof_system::test_stdlib_merkle_tree
\ No newline at end of file
+
+TEST(stdlib_merkle_tree, test_update_elements_matches_sequential_updates)
+{
+    constexpr size_t depth = 32;
+    MemoryStore batch_store;
+    MerkleTree batch_db(batch_store, depth);
+    MemoryStore store;
+    MerkleTree db(store, depth);
+
+    // Sparse indices (exercising stumps and forks), a dense run, and a duplicated index.
+    std::vector<std::pair<MerkleTree<MemoryStore>::index_t, fr>> updates;
+    for (size_t i = 0; i < 64; ++i) {
+        updates.emplace_back(engine.get_random_uint32(), fr::random_element());
+    }
+    for (size_t i = 0; i < 64; ++i) {
+        updates.emplace_back(1000 + i, VALUES[i]);
+    }
+    updates.emplace_back(1000, VALUES[100]);
+
+    for (auto const& [index, value] : updates) {
+        db.update_element(index, value);
+    }
+    EXPECT_EQ(batch_db.update_elements(updates), db.root());
+    EXPECT_EQ(batch_db.size(), db.size());
+
+    // A second batch on a non-empty tree overwrites existing leaves and forks existing stumps.
+    std::vector<std::pair<MerkleTree<MemoryStore>::index_t, fr>> more_updates;
+    for (size_t i = 0; i < 16; ++i) {
+        more_updates.emplace_back(updates[i * 8].first, fr::random_element());
+        more_updates.emplace_back(updates[i * 8].first ^ 1, fr::random_element());
+    }
+    for (auto const& [index, value] : more_updates) {
+        db.update_element(index, value);
+    }
+    EXPECT_EQ(batch_db.update_elements(more_updates), db.root());
+
+    for (auto const& [index, value] : updates) {
+        EXPECT_EQ(batch_db.get_hash_path(index), db.get_hash_path(index));
+    }
+}
+
+TEST(stdlib_merkle_tree, test_update_elements_contiguous_range)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+    MemoryStore store;
+    MerkleTree db(store, depth);
+
+    std::vector<fr> values(VALUES.begin() + 100, VALUES.begin() + 300);
+    memdb.update_elements(100, values);
+    db.update_elements(100, values);
+
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(db.size(), 300ULL);
+    EXPECT_EQ(db.get_sibling_path(150), memdb.get_sibling_path(150));
+}
+
+TEST(stdlib_merkle_tree, test_poseidon2_hashing_policy)
+{
+    constexpr size_t depth = 12;
+    MemoryStore store;
+    MerkleTree<MemoryStore, Poseidon2HashPolicy> db(store, depth);
+    MemoryStore batched_store;
+    MerkleTree<MemoryStore, Poseidon2HashPolicy> batched_db(batched_store, depth);
+    MemoryStore pedersen_store;
+    MerkleTree pedersen_db(pedersen_store, depth);
+
+    std::vector<std::pair<MerkleTree<MemoryStore>::index_t, fr>> updates;
+    for (size_t i = 0; i < 64; ++i) {
+        updates.emplace_back(i * 37 % (1 << depth), VALUES[i + 1]);
+    }
+    for (auto const& [index, value] : updates) {
+        db.update_element(index, value);
+        pedersen_db.update_element(index, value);
+    }
+    batched_db.update_elements(updates);
+
+    EXPECT_EQ(batched_db.root(), db.root());
+    EXPECT_NE(db.root(), pedersen_db.root());
+
+    // Every hash path recombines to the root with Poseidon2.
+    auto path = db.get_hash_path(37);
+    fr current = VALUES[2];
+    size_t index = 37;
+    for (auto const& [left, right] : path) {
+        EXPECT_EQ(current, (index & 1) ? right : left);
+        current = Poseidon2HashPolicy::hash_pair(left, right);
+        index >>= 1;
+    }
+    EXPECT_EQ(current, db.root());
+}
+} // namespace proof_system::test_stdlib_merkle_tree
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <map>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -113,6 +114,23 @@ inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLea
     return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
 }
 
+/**
+ * @brief Ordered index of the non-empty leaves of an indexed tree, mapping leaf value -> leaf index.
+ *
+ * Answers the same query as the linear scan above (the leaf with the largest value not greater than `new_value`) in
+ * O(log n). Empty leaves never need to be indexed: they compare like a leaf of value 0, which always loses to the
+ * initial leaf at index 0.
+ */
+using nullifier_leaf_index = std::map<uint256_t, size_t>;
+
+inline std::pair<size_t, bool> find_closest_leaf(nullifier_leaf_index const& leaf_indices, fr const& new_value)
+{
+    auto it = leaf_indices.upper_bound(uint256_t(new_value));
+    ASSERT(it != leaf_indices.begin());
+    --it;
+    return std::make_pair(it->second, it->first == uint256_t(new_value));
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
@@ -1,5 +1,7 @@
 #include "nullifier_memory_tree.hpp"
 #include "../hash.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <numeric>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -25,6 +27,7 @@ NullifierMemoryTree::NullifierMemoryTree(size_t depth)
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
+    leaf_indices_[0] = 0;
     root_ = update_element(0, initial_leaf.hash());
 }
 
@@ -41,7 +44,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_low_leaf(value);
 
     nullifier_leaf current_leaf = leaves_[current].unwrap();
     nullifier_leaf new_leaf = { .value = value,
@@ -57,6 +60,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
         leaves_.push_back(new_leaf);
+        leaf_indices_[uint256_t(value)] = leaves_.size() - 1;
     }
 
     // Update the old leaf in the tree
@@ -72,6 +76,71 @@ fr NullifierMemoryTree::update_element(fr const& value)
     return root;
 }
 
+std::vector<NullifierMemoryTree::LowLeafWitness> NullifierMemoryTree::batch_insert(std::vector<fr> const& values)
+{
+    const size_t start_index = leaves_.size();
+    if (values.size() > total_size_ - start_index) {
+        throw_or_abort("NullifierMemoryTree::batch_insert: batch does not fit in the tree");
+    }
+
+    // Process the values from largest to smallest. A new leaf can then never be the low leaf of a later value in the
+    // batch, so every low leaf is an existing leaf and the new leaves inherit the pointers that the larger values of
+    // the batch have already written into it.
+    std::vector<size_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return uint256_t(values[a]) > uint256_t(values[b]);
+    });
+
+    // Reject the whole batch before any leaf is touched, so a failed insertion leaves the tree unchanged.
+    for (size_t i = 1; i < order.size(); ++i) {
+        if (values[order[i]] != 0 && values[order[i - 1]] == values[order[i]]) {
+            throw_or_abort("NullifierMemoryTree::batch_insert: duplicate value in batch");
+        }
+    }
+
+    std::vector<LowLeafWitness> witnesses(values.size());
+    std::vector<WrappedNullifierLeaf> pending(values.size(), WrappedNullifierLeaf::zero());
+    for (size_t i = 0; i < order.size(); ++i) {
+        const size_t position = order[i];
+        const fr& value = values[position];
+
+        if (value == 0) {
+            witnesses[position] = { nullifier_leaf{ 0, 0, 0 }, 0, fr_sibling_path(depth_, fr::zero()) };
+            continue;
+        }
+        auto [low_index, is_already_present] = find_low_leaf(value);
+        nullifier_leaf low_leaf = leaves_[low_index].unwrap();
+        witnesses[position] = { low_leaf, low_index, get_sibling_path(low_index) };
+
+        if (is_already_present) {
+            continue;
+        }
+
+        pending[position] = nullifier_leaf{ .value = value,
+                                            .nextIndex = low_leaf.nextIndex,
+                                            .nextValue = low_leaf.nextValue };
+        low_leaf.nextIndex = start_index + position;
+        low_leaf.nextValue = value;
+        leaves_[low_index].set(low_leaf);
+        update_element(low_index, low_leaf.hash());
+    }
+
+    std::vector<fr> pending_hashes(pending.size());
+    for (size_t i = 0; i < pending.size(); ++i) {
+        if (pending[i].has_value()) {
+            leaf_indices_[uint256_t(values[i])] = start_index + i;
+        }
+        pending_hashes[i] = pending[i].hash();
+        leaves_.push_back(pending[i]);
+    }
+    if (!pending_hashes.empty()) {
+        root_ = update_elements(start_index, pending_hashes);
+    }
+
+    return witnesses;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
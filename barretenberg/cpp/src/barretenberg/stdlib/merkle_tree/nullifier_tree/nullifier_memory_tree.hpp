@@ -78,6 +78,34 @@ class NullifierMemoryTree : public MemoryTree {
 
     fr update_element(fr const& value);
 
+    /**
+     * Witness for the low leaf of an inserted value: the low leaf preimage, its index and its sibling path, all taken
+     * immediately before the low leaf was updated to point at the new leaf.
+     */
+    struct LowLeafWitness {
+        nullifier_leaf leaf;
+        size_t index;
+        fr_sibling_path sibling_path;
+    };
+
+    /**
+     * Inserts a batch of values as a contiguous subtree starting at the current size of the tree.
+     *
+     * Values are processed in descending order, so each low leaf is found in the ordered index with a single
+     * predecessor lookup, and all low-leaf witnesses are produced in one pass. The new leaves are then written with
+     * `update_elements`, hashing the inserted subtree once. The value at position i is placed at leaf index
+     * size() + i; zero values and values already in the tree leave an empty leaf at their position, and zero values
+     * get an empty witness. Duplicate non-zero values within a batch are rejected.
+     *
+     * Returns the low-leaf witnesses in the order of `values`.
+     */
+    std::vector<LowLeafWitness> batch_insert(std::vector<fr> const& values);
+
+    /**
+     * Returns the index of the leaf with the largest value not greater than `value`, and whether it is equal to it.
+     */
+    std::pair<size_t, bool> find_low_leaf(fr const& value) const { return find_closest_leaf(leaf_indices_, value); }
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
     {
@@ -91,6 +119,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::root_;
     using MemoryTree::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    nullifier_leaf_index leaf_indices_;
 };
 
 } // namespace merkle_tree
@@ -368,4 +368,102 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+TEST(crypto_nullifier_tree, test_batch_insert_matches_sequential_insertion)
+{
+    constexpr size_t depth = 10;
+    NullifierMemoryTree batched(depth);
+    NullifierMemoryTree sequential(depth);
+
+    for (size_t i = 0; i < 20; i++) {
+        auto value = fr::random_element();
+        batched.update_element(value);
+        sequential.update_element(value);
+    }
+
+    std::vector<fr> values(100);
+    for (auto& value : values) {
+        value = fr::random_element();
+    }
+    values[17] = 0;
+    values[42] = 0;
+
+    auto witnesses = batched.batch_insert(values);
+    for (auto& value : values) {
+        sequential.update_element(value);
+    }
+
+    EXPECT_EQ(batched.root(), sequential.root());
+    EXPECT_EQ(batched.get_leaves(), sequential.get_leaves());
+    EXPECT_EQ(batched.get_hashes(), sequential.get_hashes());
+
+    ASSERT_EQ(witnesses.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        const auto& witness = witnesses[i];
+        if (values[i] == 0) {
+            EXPECT_EQ(witness.leaf, (nullifier_leaf{ 0, 0, 0 }));
+            continue;
+        }
+        // The low leaf proves non-membership of the inserted value at the time it was updated.
+        EXPECT_LT(uint256_t(witness.leaf.value), uint256_t(values[i]));
+        EXPECT_TRUE(witness.leaf.nextValue == 0 || uint256_t(witness.leaf.nextValue) > uint256_t(values[i]));
+        EXPECT_EQ(witness.sibling_path.size(), depth);
+    }
+
+    // Values already in the tree only take up an empty leaf, and their witnesses point at the existing leaves.
+    auto root = batched.root();
+    auto repeated = batched.batch_insert({ values[0], values[1] });
+    EXPECT_EQ(repeated[0].index, 20 + 1);
+    EXPECT_EQ(repeated[1].index, 20 + 2);
+    EXPECT_EQ(batched.get_leaves().size(), 20 + 1 + values.size() + 2);
+    EXPECT_EQ(batched.root(), root);
+}
+
+TEST(crypto_nullifier_tree, test_batch_insert_low_leaf_witness)
+{
+    constexpr size_t depth = 3;
+    NullifierMemoryTree tree(depth);
+    tree.update_element(30);
+    tree.update_element(10);
+
+    // A witness of a single insertion opens the low leaf against the root before the insertion.
+    auto root = tree.root();
+    auto witnesses = tree.batch_insert({ 20 });
+    EXPECT_EQ(witnesses[0].index, 2);
+    EXPECT_EQ(witnesses[0].leaf, (nullifier_leaf{ 10, 1, 30 }));
+    auto current = witnesses[0].leaf.hash();
+    size_t index = witnesses[0].index;
+    for (const auto& sibling : witnesses[0].sibling_path) {
+        current = (index & 1) ? hash_pair_native(sibling, current) : hash_pair_native(current, sibling);
+        index >>= 1;
+    }
+    EXPECT_EQ(current, root);
+
+    /**
+     * Insert 25 and 15 in one batch: both low leaves are existing leaves (20 and 10), whose pointers are passed on to
+     * the new leaves.
+     *
+     *  index     0       1       2       3        4       5       6       7
+     *  ---------------------------------------------------------------------
+     *  val       0       30      10      20       25      15      0       0
+     *  nextIdx   2       0       5       4        1       3       0       0
+     *  nextVal   10      0       15      25       30      20      0       0
+     */
+    witnesses = tree.batch_insert({ 25, 15 });
+    EXPECT_EQ(witnesses[0].index, 3);
+    EXPECT_EQ(witnesses[0].leaf, (nullifier_leaf{ 20, 1, 30 }));
+    EXPECT_EQ(witnesses[1].index, 2);
+    EXPECT_EQ(witnesses[1].leaf, (nullifier_leaf{ 10, 3, 20 }));
+    EXPECT_EQ(tree.get_leaf(2).unwrap(), (nullifier_leaf{ 10, 5, 15 }));
+    EXPECT_EQ(tree.get_leaf(3).unwrap(), (nullifier_leaf{ 20, 4, 25 }));
+    EXPECT_EQ(tree.get_leaf(4).unwrap(), (nullifier_leaf{ 25, 1, 30 }));
+    EXPECT_EQ(tree.get_leaf(5).unwrap(), (nullifier_leaf{ 15, 3, 20 }));
+
+    // A rejected batch leaves the tree untouched, even when some of its values could have been inserted.
+    root = tree.root();
+    auto leaves = tree.get_leaves();
+    EXPECT_THROW(tree.batch_insert({ 50, 40, 40 }), std::runtime_error);
+    EXPECT_THROW(tree.batch_insert({ 40, 45, 50 }), std::runtime_error);
+    EXPECT_EQ(tree.root(), root);
+    EXPECT_EQ(tree.get_leaves(), leaves);
+}
@@ -36,6 +36,7 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     using MerkleTree<Store>::depth_;
     using MerkleTree<Store>::tree_id_;
     std::vector<WrappedNullifierLeaf> leaves;
+    nullifier_leaf_index leaf_indices_;
 };
 
 extern template class NullifierTree<MemoryStore>;
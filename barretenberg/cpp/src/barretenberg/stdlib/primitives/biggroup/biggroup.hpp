@@ -171,10 +171,11 @@ template <class Builder, class Fq, class Fr, class NativeGroup> class element {
     }
 
     // compute a multi-scalar-multiplication by creating a precomputed lookup table for each point,
-    // splitting each scalar multiplier up into a 4-bit sliding window wNAF.
-    // more efficient than batch_mul if num_points < 4
-    // only works with Plookup!
-    template <size_t max_num_bits = 0>
+    // splitting each scalar multiplier up into a WNAF_SIZE-bit sliding window wNAF.
+    // more efficient than the linear-combination tables of batch_mul if num_points <= 2
+    // (batch_mul dispatches here for such batches); only works with Plookup!
+    static constexpr size_t MAX_NUM_POINTS_FOR_WNAF_BATCH_MUL = 2;
+    template <size_t max_num_bits = 0, size_t WNAF_SIZE = 4>
     static element wnaf_batch_mul(const std::vector<element>& points, const std::vector<Fr>& scalars);
     static element batch_mul(const std::vector<element>& points,
                              const std::vector<Fr>& scalars,
@@ -264,20 +265,28 @@ template <class Builder, class Fq, class Fr, class NativeGroup> class element {
 
     static std::pair<element, element> compute_offset_generators(const size_t num_rounds);
 
-    template <typename = typename std::enable_if<HasPlookup<Builder>>> struct four_bit_table_plookup {
-        four_bit_table_plookup(){};
-        four_bit_table_plookup(const element& input);
+    /**
+     * ROM table of the odd multiples [-(2^w - 1)P, ..., -P, P, ..., (2^w - 1)P] of a point P, indexed by the raw
+     * entries produced by `compute_wnaf<max_num_bits, w>`
+     */
+    template <size_t wnaf_size, typename = typename std::enable_if<HasPlookup<Builder>>> struct wnaf_table_plookup {
+        static constexpr size_t table_size = (1ULL << wnaf_size);
+        wnaf_table_plookup(){};
+        wnaf_table_plookup(const element& input);
 
-        four_bit_table_plookup(const four_bit_table_plookup& other) = default;
-        four_bit_table_plookup& operator=(const four_bit_table_plookup& other) = default;
+        wnaf_table_plookup(const wnaf_table_plookup& other) = default;
+        wnaf_table_plookup& operator=(const wnaf_table_plookup& other) = default;
 
         element operator[](const field_t<Builder>& index) const;
         element operator[](const size_t idx) const { return element_table[idx]; }
-        std::array<element, 16> element_table;
+        std::array<element, table_size> element_table;
         std::array<twin_rom_table<Builder>, 5> coordinates;
         std::array<uint256_t, 8> limb_max; // tracks the maximum limb size represented in each element_table entry
     };
 
+    template <typename X = typename std::enable_if<HasPlookup<Builder>>>
+    using four_bit_table_plookup = wnaf_table_plookup<4, X>;
+
     template <typename = typename std::enable_if<HasPlookup<Builder>>> struct eight_bit_fixed_base_table {
         enum CurveType { BN254, SECP256K1, SECP256R1 };
         eight_bit_fixed_base_table(const CurveType input_curve_type, bool use_endo)
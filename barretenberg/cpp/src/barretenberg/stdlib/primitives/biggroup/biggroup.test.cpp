@@ -374,6 +374,44 @@ template <typename TestType> class stdlib_biggroup : public testing::Test {
         EXPECT_CIRCUIT_CORRECTNESS(builder);
     }
 
+    // with Plookup, batches this small are evaluated with per-point wNAF tables
+    static void test_batch_mul_small_batches()
+    {
+        for (size_t num_points = 1; num_points <= 2; ++num_points) {
+            Builder builder;
+            std::vector<affine_element> points;
+            std::vector<fr> scalars;
+            for (size_t i = 0; i < num_points; ++i) {
+                points.push_back(affine_element(element::random_element()));
+                scalars.push_back(fr::random_element());
+            }
+
+            std::vector<element_ct> circuit_points;
+            std::vector<scalar_ct> circuit_scalars;
+            for (size_t i = 0; i < num_points; ++i) {
+                circuit_points.push_back(element_ct::from_witness(&builder, points[i]));
+                circuit_scalars.push_back(scalar_ct::from_witness(&builder, scalars[i]));
+            }
+
+            element_ct result_point = element_ct::batch_mul(circuit_points, circuit_scalars);
+
+            element expected_point = g1::one;
+            expected_point.self_set_infinity();
+            for (size_t i = 0; i < num_points; ++i) {
+                expected_point += (element(points[i]) * scalars[i]);
+            }
+
+            expected_point = expected_point.normalize();
+            fq result_x(result_point.x.get_value().lo);
+            fq result_y(result_point.y.get_value().lo);
+
+            EXPECT_EQ(result_x, expected_point.x);
+            EXPECT_EQ(result_y, expected_point.y);
+
+            EXPECT_CIRCUIT_CORRECTNESS(builder);
+        }
+    }
+
     static void test_chain_add()
     {
         Builder builder = Builder();
@@ -825,6 +863,7 @@ template <typename TestType> class stdlib_biggroup : public testing::Test {
 
 enum UseBigfield { No, Yes };
 using TestTypes = testing::Types<TestType<stdlib::bn254<proof_system::StandardCircuitBuilder>, UseBigfield::No>,
+                                 TestType<stdlib::bn254<proof_system::UltraCircuitBuilder>, UseBigfield::No>,
                                  TestType<stdlib::bn254<proof_system::UltraCircuitBuilder>, UseBigfield::Yes>>;
 
 TYPED_TEST_SUITE(stdlib_biggroup, TestTypes);
@@ -869,6 +908,14 @@ HEAVY_TYPED_TEST(stdlib_biggroup, batch_mul)
 {
     TestFixture::test_batch_mul();
 }
+HEAVY_TYPED_TEST(stdlib_biggroup, batch_mul_small_batches)
+{
+    if constexpr (HasPlookup<typename TypeParam::Curve::Builder> && !TypeParam::use_bigfield) {
+        TestFixture::test_batch_mul_small_batches();
+    } else {
+        GTEST_SKIP();
+    }
+}
 HEAVY_TYPED_TEST(stdlib_biggroup, chain_add)
 {
 
@@ -4,34 +4,37 @@ namespace proof_system::plonk {
 namespace stdlib {
 
 /**
- * only works for Plookup (otherwise falls back on batch_mul)! Multiscalar multiplication that utilizes 4-bit wNAF
- * lookup tables is more efficient than points-as-linear-combinations lookup tables, if the number of points is 3 or
- * fewer
+ * only works for Plookup (otherwise falls back on batch_mul)! Multiscalar multiplication that utilizes WNAF_SIZE-bit
+ * wNAF lookup tables is more efficient than points-as-linear-combinations lookup tables, if the number of points is 2
+ * or fewer. All points share one doubling chain and one offset generator correction; wider windows trade larger
+ * per-point ROM tables (2^WNAF_SIZE entries) for fewer additions per point
  */
 template <typename C, class Fq, class Fr, class G>
-template <size_t max_num_bits>
+template <size_t max_num_bits, size_t WNAF_SIZE>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::wnaf_batch_mul(const std::vector<element>& points,
                                                             const std::vector<Fr>& scalars)
 {
-    constexpr size_t WNAF_SIZE = 4;
+    static_assert(WNAF_SIZE >= 2);
+    // the wNAF reconstruction of a bigfield scalar in `compute_wnaf` assumes 4-bit slices
+    static_assert(WNAF_SIZE == 4 || !Fr::is_composite);
     ASSERT(points.size() == scalars.size());
     if constexpr (!HasPlookup<C>) {
         return batch_mul(points, scalars, max_num_bits);
     }
 
-    std::vector<four_bit_table_plookup<>> point_tables;
+    std::vector<wnaf_table_plookup<WNAF_SIZE>> point_tables;
     for (const auto& point : points) {
-        point_tables.emplace_back(four_bit_table_plookup<>(point));
+        point_tables.emplace_back(wnaf_table_plookup<WNAF_SIZE>(point));
     }
 
     std::vector<std::vector<field_t<C>>> wnaf_entries;
     for (const auto& scalar : scalars) {
-        wnaf_entries.emplace_back(compute_wnaf<max_num_bits>(scalar));
+        wnaf_entries.emplace_back(compute_wnaf<max_num_bits, WNAF_SIZE>(scalar));
     }
 
     constexpr size_t num_bits = (max_num_bits == 0) ? (Fr::modulus.get_msb() + 1) : (max_num_bits);
     constexpr size_t num_rounds = ((num_bits + WNAF_SIZE - 1) / WNAF_SIZE);
-    const auto offset_generators = compute_offset_generators(num_rounds * 4 - 3);
+    const auto offset_generators = compute_offset_generators(num_rounds * WNAF_SIZE - (WNAF_SIZE - 1));
 
     element accumulator = offset_generators.first + point_tables[0][wnaf_entries[0][0]];
     for (size_t i = 1; i < points.size(); ++i) {
@@ -39,8 +42,10 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::wnaf_batch_mul(const std::vector<el
     }
 
     for (size_t i = 1; i < num_rounds; ++i) {
-        accumulator = accumulator.dbl();
-        accumulator = accumulator.dbl();
+        // `quadruple_and_add` performs the last two doublings of the round
+        for (size_t j = 0; j < WNAF_SIZE - 2; ++j) {
+            accumulator = accumulator.dbl();
+        }
         std::vector<element> to_add;
         for (size_t j = 0; j < points.size(); ++j) {
             to_add.emplace_back(point_tables[j][wnaf_entries[j][i]]);
@@ -594,6 +594,10 @@ std::pair<element<C, Fq, Fr, G>, element<C, Fq, Fr, G>> element<C, Fq, Fr, G>::c
  *
  * Implementation is identical to `bn254_endo_batch_mul` but WITHOUT the endomorphism transforms OR support for short
  * scalars See `bn254_endo_batch_mul` for description of algorithm
+ *
+ * With Plookup, batches of at most `MAX_NUM_POINTS_FOR_WNAF_BATCH_MUL` points are delegated to `wnaf_batch_mul`:
+ * per-point wNAF ROM tables (5-bit windows for full-width scalars) are cheaper than the linear-combination tables of
+ * `batch_lookup_table` when there are too few points to combine
  **/
 template <typename C, class Fq, class Fr, class G>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::batch_mul(const std::vector<element>& points,
@@ -607,6 +611,16 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::batch_mul(const std::vector<element
 
     const size_t num_points = points.size();
     ASSERT(scalars.size() == num_points);
+    if constexpr (HasPlookup<C> && !Fr::is_composite) {
+        if (num_points <= MAX_NUM_POINTS_FOR_WNAF_BATCH_MUL) {
+            if (max_num_bits == 0) {
+                return wnaf_batch_mul<0, 5>(points, scalars);
+            }
+            if (max_num_bits == 128) {
+                return wnaf_batch_mul<128, 4>(points, scalars);
+            }
+        }
+    }
     batch_lookup_table point_table(points);
     const size_t num_rounds = (max_num_bits == 0) ? Fr::modulus.get_msb() + 1 : max_num_bits;
 
@@ -89,27 +89,29 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::read_group_element_rom_tables(
 }
 
 template <typename C, class Fq, class Fr, class G>
-template <typename X>
-element<C, Fq, Fr, G>::four_bit_table_plookup<X>::four_bit_table_plookup(const element& input)
+template <size_t wnaf_size, typename X>
+element<C, Fq, Fr, G>::wnaf_table_plookup<wnaf_size, X>::wnaf_table_plookup(const element& input)
 {
+    constexpr size_t midpoint = table_size / 2;
     element d2 = input.dbl();
 
-    element_table[8] = input;
-    for (size_t i = 9; i < 16; ++i) {
+    element_table[midpoint] = input;
+    for (size_t i = midpoint + 1; i < table_size; ++i) {
         element_table[i] = element_table[i - 1] + d2;
     }
-    for (size_t i = 0; i < 8; ++i) {
-        element_table[i] = (-element_table[15 - i]);
+    for (size_t i = 0; i < midpoint; ++i) {
+        element_table[i] = (-element_table[table_size - 1 - i]);
     }
 
-    coordinates = create_group_element_rom_tables<16>(element_table, limb_max);
+    coordinates = create_group_element_rom_tables<table_size>(element_table, limb_max);
 }
 
 template <typename C, class Fq, class Fr, class G>
-template <typename X>
-element<C, Fq, Fr, G> element<C, Fq, Fr, G>::four_bit_table_plookup<X>::operator[](const field_t<C>& index) const
+template <size_t wnaf_size, typename X>
+element<C, Fq, Fr, G> element<C, Fq, Fr, G>::wnaf_table_plookup<wnaf_size, X>::operator[](
+    const field_t<C>& index) const
 {
-    return read_group_element_rom_tables<16>(coordinates, index, limb_max);
+    return read_group_element_rom_tables<table_size>(coordinates, index, limb_max);
 }
 
 template <class C, class Fq, class Fr, class G>
@@ -528,6 +528,69 @@ TYPED_TEST(CycleGroupTest, TestBatchMul)
     EXPECT_EQ(check_result, true);
 }
 
+TYPED_TEST(CycleGroupTest, TestBatchMulRegisteredFixedBase)
+{
+    STDLIB_TYPE_ALIASES
+
+    const size_t num_muls = 3;
+    // The registry is process-global, so use a fixed point and slot: every instantiation (and every gtest repetition)
+    // then performs the same, idempotent registration
+    constexpr size_t slot = 0;
+    const auto test_points = Group::derive_generators("cycle_group_test_registered_fixed_base", 2);
+    const AffineElement registered_point = test_points[0];
+    const AffineElement unregistered_point = Group::one * Group::subgroup_field::random_element(&engine);
+    EXPECT_TRUE(plookup::fixed_base::table::register_point(slot, registered_point));
+    EXPECT_TRUE(plookup::fixed_base::table::lookup_table_exists_for_point(registered_point));
+    const auto table_ids = plookup::fixed_base::table::get_lookup_table_ids_for_point(registered_point);
+    EXPECT_EQ(table_ids.value()[0], plookup::MultiTableId::FIXED_BASE_REGISTERED_0_LO);
+    // registering twice is a no-op
+    EXPECT_TRUE(plookup::fixed_base::table::register_point(slot, registered_point));
+    // a slot holds a single point, and a point a single slot
+    EXPECT_FALSE(plookup::fixed_base::table::register_point(slot, test_points[1]));
+    EXPECT_FALSE(plookup::fixed_base::table::register_point(slot + 1, registered_point));
+    EXPECT_FALSE(plookup::fixed_base::table::register_point(plookup::fixed_base::table::MAX_NUM_REGISTERED_POINTS,
+                                                            test_points[1]));
+    EXPECT_FALSE(plookup::fixed_base::table::lookup_table_exists_for_point(test_points[1]));
+    // reading the tables of a slot that holds no point is an error, slot + 1 was left empty above
+    EXPECT_THROW(plookup::fixed_base::table::get_fixed_base_scalar_mul_tables(
+                     plookup::fixed_base::table::NUM_FIXED_BASE_MULTI_TABLES + ((slot + 1) * 2)),
+                 std::runtime_error);
+
+    const auto compute_batch_mul = [&](const AffineElement& base_point,
+                                       const std::vector<typename Group::subgroup_field>& native_scalars) {
+        auto builder = Builder();
+        std::vector<cycle_group_ct> points;
+        std::vector<typename cycle_group_ct::cycle_scalar> scalars;
+        Element expected = Group::point_at_infinity;
+        for (const auto& scalar : native_scalars) {
+            expected += (base_point * scalar);
+            points.emplace_back(base_point);
+            scalars.emplace_back(cycle_group_ct::cycle_scalar::from_witness(&builder, scalar));
+        }
+        // mix in a point that has a precomputed table
+        expected += (plookup::fixed_base::table::LHS_GENERATOR_POINT * native_scalars[0]);
+        points.emplace_back(plookup::fixed_base::table::LHS_GENERATOR_POINT);
+        scalars.emplace_back(cycle_group_ct::cycle_scalar::from_witness(&builder, native_scalars[0]));
+
+        auto result = cycle_group_ct::batch_mul(scalars, points);
+        EXPECT_EQ(result.get_value(), AffineElement(expected));
+        EXPECT_TRUE(builder.check_circuit());
+        return builder.get_num_gates();
+    };
+
+    std::vector<typename Group::subgroup_field> native_scalars;
+    for (size_t i = 0; i < num_muls; ++i) {
+        native_scalars.emplace_back(Group::subgroup_field::random_element(&engine));
+    }
+    const size_t registered_gates = compute_batch_mul(registered_point, native_scalars);
+    const size_t unregistered_gates = compute_batch_mul(unregistered_point, native_scalars);
+    if constexpr (cycle_group_ct::IS_ULTRA) {
+        EXPECT_LT(registered_gates, unregistered_gates);
+    } else {
+        EXPECT_EQ(registered_gates, unregistered_gates);
+    }
+}
+
 TYPED_TEST(CycleGroupTest, TestMul)
 {
     STDLIB_TYPE_ALIASES
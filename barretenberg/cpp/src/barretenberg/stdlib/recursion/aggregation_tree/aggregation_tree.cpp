@@ -0,0 +1,205 @@
+#include "aggregation_tree.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/stdlib/recursion/verifier/verifier.hpp"
+
+#include <map>
+
+namespace proof_system::plonk::stdlib::recursion {
+
+namespace {
+
+/**
+ * @brief Runs `func` over every node of a level concurrently.
+ *
+ * @details With OpenMP, a parallel_for issued from inside a worker runs serially on that worker. The mutex-pool fallback
+ * is not reentrant, so builds without OpenMP process nodes one at a time.
+ */
+void for_each_node(size_t num_nodes, const std::function<void(size_t)>& func)
+{
+#ifndef NO_OMP_MULTITHREADING
+    parallel_for(num_nodes, func);
+#else
+    for (size_t i = 0; i < num_nodes; ++i) {
+        func(i);
+    }
+#endif
+}
+
+} // namespace
+
+AggregationTree::AggregationTree(size_t arity)
+    : arity(arity)
+{
+    if (arity < 2) {
+        throw_or_abort("AggregationTree: arity must be at least 2");
+    }
+}
+
+/**
+ * @brief Aggregates `proofs` of the circuit described by `verification_key` into a single root proof.
+ *
+ * @details A single proof is still wrapped in one node, so the result always carries an aggregation object and can be
+ * verified (or recursively verified) the same way regardless of the number of leaves.
+ */
+AggregationTree::Node AggregationTree::aggregate(const std::vector<plonk::proof>& proofs,
+                                                 const std::shared_ptr<plonk::verification_key>& verification_key)
+{
+    if (proofs.empty()) {
+        throw_or_abort("AggregationTree: no proofs to aggregate");
+    }
+
+    std::vector<Node> level;
+    level.reserve(proofs.size());
+    for (const auto& proof : proofs) {
+        level.push_back({ proof, verification_key });
+    }
+
+    do {
+        level = aggregate_level(level);
+    } while (level.size() > 1);
+
+    return level[0];
+}
+
+/**
+ * @brief Returns a power of two bounding the size of every node circuit, e.g. for sizing the prover CRS up front.
+ */
+size_t AggregationTree::get_max_node_circuit_size() const
+{
+    return 1UL << (numeric::get_msb(arity * MAX_GATES_PER_CHILD - 1) + 1);
+}
+
+/**
+ * @brief Natively verifies a node proof, including the pairing check on its aggregation object.
+ */
+bool AggregationTree::verify(const Node& node)
+{
+    Composer composer(nullptr, node.verification_key);
+    Builder builder;
+    builder.public_inputs.resize(node.verification_key->num_public_inputs);
+    auto verifier = composer.create_verifier(builder);
+    return verifier.verify_proof(node.proof);
+}
+
+/**
+ * @brief Constructs the circuit of a node that recursively verifies `children`.
+ *
+ * @details Child verification keys are circuit constants: every child of a level shares the key of the level below,
+ * so nothing is gained by making them witnesses, and constants bind the tree to the keys it was built with.
+ */
+void AggregationTree::construct_node_circuit(Builder& builder, std::span<const Node> children)
+{
+    aggregation_state<Curve> output;
+    for (const auto& child : children) {
+        auto key = verification_key<Curve>::from_constants(&builder, child.verification_key);
+        const auto manifest = Composer::create_manifest(child.verification_key->num_public_inputs);
+        output = verify_proof<Curve, RecursiveSettings>(&builder, key, manifest, child.proof, output);
+
+        // Forward the child's own public inputs; its aggregation object has been folded into `output` instead.
+        const auto& nested_indices = child.verification_key->recursive_proof_public_input_indices;
+        for (size_t i = 0; i < output.public_inputs.size(); ++i) {
+            const bool is_nested = child.verification_key->contains_recursive_proof &&
+                                   std::find(nested_indices.begin(), nested_indices.end(), i) != nested_indices.end();
+            if (!is_nested) {
+                output.public_inputs[i].set_public();
+            }
+        }
+    }
+    output.add_proof_outputs_as_public_inputs();
+}
+
+AggregationTree::NodeKeys AggregationTree::compute_node_keys(Builder& builder)
+{
+    Composer composer;
+    NodeKeys keys;
+    keys.proving_key = composer.compute_proving_key(builder);
+    keys.verification_key = composer.compute_verification_key(builder);
+    keys.num_gates = builder.num_gates;
+    keys.num_public_inputs = builder.public_inputs.size();
+    num_proving_keys_computed++;
+    return keys;
+}
+
+/**
+ * @brief Builds and proves the parent nodes of `children`, grouping them `arity` at a time.
+ *
+ * @details Nodes are keyed on the verification keys of their children: equal keys give structurally identical
+ * circuits, so there are at most two distinct shapes per level (full nodes and a trailing partial node). The first
+ * node of each shape is built serially, which computes the shared keys and initialises the lazily built lookup tables
+ * before any concurrent circuit construction. The remaining circuits are then built concurrently.
+ *
+ * Nodes are always proven one at a time, each with the whole thread pool: the polynomial arithmetic behind the prover
+ * (e.g. the FFT scratch space) is shared process-wide, so two proofs must never run at once.
+ */
+std::vector<AggregationTree::Node> AggregationTree::aggregate_level(const std::vector<Node>& children)
+{
+    using Shape = std::vector<const plonk::verification_key*>;
+
+    const size_t num_nodes = (children.size() + arity - 1) / arity;
+
+    const auto get_children = [&](size_t i) {
+        const size_t start = i * arity;
+        return std::span<const Node>(children).subspan(start, std::min(arity, children.size() - start));
+    };
+    const auto get_shape = [&](size_t i) {
+        Shape shape;
+        for (const auto& child : get_children(i)) {
+            shape.push_back(child.verification_key.get());
+        }
+        return shape;
+    };
+
+    std::vector<Builder> builders(num_nodes);
+    std::vector<uint8_t> constructed(num_nodes, 0);
+    std::map<Shape, NodeKeys> keys;
+    for (size_t i = 0; i < num_nodes; ++i) {
+        auto shape = get_shape(i);
+        if (!keys.contains(shape)) {
+            construct_node_circuit(builders[i], get_children(i));
+            keys.emplace(std::move(shape), compute_node_keys(builders[i]));
+            constructed[i] = 1;
+        }
+    }
+
+    for_each_node(num_nodes, [&](size_t i) {
+        if (constructed[i] == 0) {
+            construct_node_circuit(builders[i], get_children(i));
+        }
+    });
+
+    // Each prover writes its witness polynomials into the proving key, so every node but the last of each shape proves
+    // with its own copy; the last one takes the shared key itself.
+    std::vector<uint8_t> takes_shared_key(num_nodes, 0);
+    std::map<Shape, size_t> last_node_of_shape;
+    for (size_t i = 0; i < num_nodes; ++i) {
+        last_node_of_shape[get_shape(i)] = i;
+    }
+    for (const auto& [shape, i] : last_node_of_shape) {
+        takes_shared_key[i] = 1;
+    }
+
+    std::vector<Node> nodes(num_nodes);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        auto& builder = builders[i];
+        auto& node_keys = keys.at(get_shape(i));
+
+        builder.finalize_circuit();
+        const bool matches_shape =
+            builder.num_gates == node_keys.num_gates && builder.public_inputs.size() == node_keys.num_public_inputs;
+
+        Composer composer;
+        if (matches_shape) {
+            auto proving_key = takes_shared_key[i] != 0 ? std::move(node_keys.proving_key)
+                                                        : std::make_shared<plonk::proving_key>(*node_keys.proving_key);
+            composer = Composer(std::move(proving_key), node_keys.verification_key);
+        }
+        auto prover = composer.create_prover(builder);
+        nodes[i] = { prover.construct_proof(), composer.compute_verification_key(builder) };
+    }
+
+    return nodes;
+}
+
+} // namespace proof_system::plonk::stdlib::recursion
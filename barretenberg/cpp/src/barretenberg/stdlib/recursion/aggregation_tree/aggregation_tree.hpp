@@ -0,0 +1,70 @@
+#pragma once
+
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/plonk/proof_system/types/proof.hpp"
+#include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/recursion/verifier/program_settings.hpp"
+
+#include <span>
+
+namespace proof_system::plonk::stdlib::recursion {
+
+/**
+ * @brief Aggregates many UltraPlonk proofs into a single proof by building a tree of recursive verifier circuits.
+ *
+ * @details Every node of the tree is an UltraPlonk circuit that verifies up to `arity` child proofs. A node forwards
+ * the public inputs of its children (in child order, minus any nested aggregation object) and exposes the accumulated
+ * pairing points as its last 16 public inputs, so the root proof carries the public inputs of every leaf followed by
+ * a single aggregation object.
+ *
+ * The tree is built one level at a time. All full nodes of a level verify children with the same verification key, so
+ * their circuits are structurally identical: the proving key is computed once per distinct node shape and copied into
+ * each node's prover. Within a level, node circuits are constructed concurrently over the global thread pool, then
+ * proven one at a time with the whole pool per proof. Proof inputs must have been created with `UltraComposer::create_prover` (i.e. the recursion friendly
+ * transcript).
+ */
+class AggregationTree {
+  public:
+    using Composer = plonk::UltraComposer;
+    using Builder = UltraCircuitBuilder;
+    using Curve = bn254<Builder>;
+    using RecursiveSettings = recursive_ultra_verifier_settings<Curve>;
+
+    struct Node {
+        plonk::proof proof;
+        std::shared_ptr<plonk::verification_key> verification_key;
+    };
+
+    // Upper bound on the gates that one recursive UltraPlonk verification adds to a node circuit.
+    static constexpr size_t MAX_GATES_PER_CHILD = 1UL << 18;
+
+    explicit AggregationTree(size_t arity = 2);
+
+    Node aggregate(const std::vector<plonk::proof>& proofs,
+                   const std::shared_ptr<plonk::verification_key>& verification_key);
+
+    static bool verify(const Node& node);
+
+    static void construct_node_circuit(Builder& builder, std::span<const Node> children);
+
+    [[nodiscard]] size_t get_max_node_circuit_size() const;
+
+    [[nodiscard]] size_t get_num_proving_keys_computed() const { return num_proving_keys_computed; }
+
+  private:
+    struct NodeKeys {
+        std::shared_ptr<plonk::proving_key> proving_key;
+        std::shared_ptr<plonk::verification_key> verification_key;
+        size_t num_gates = 0;
+        size_t num_public_inputs = 0;
+    };
+
+    size_t arity;
+    size_t num_proving_keys_computed = 0;
+
+    std::vector<Node> aggregate_level(const std::vector<Node>& children);
+    NodeKeys compute_node_keys(Builder& builder);
+};
+
+} // namespace proof_system::plonk::stdlib::recursion
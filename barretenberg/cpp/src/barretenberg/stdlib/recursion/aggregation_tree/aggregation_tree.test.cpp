@@ -0,0 +1,117 @@
+#include "aggregation_tree.hpp"
+
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "barretenberg/stdlib/primitives/witness/witness.hpp"
+
+namespace proof_system::plonk::stdlib::recursion {
+
+class AggregationTreeTests : public testing::Test {
+  protected:
+    using Builder = AggregationTree::Builder;
+    using Composer = AggregationTree::Composer;
+    using field_ct = field_t<Builder>;
+    using witness_ct = witness_t<Builder>;
+    using public_witness_ct = public_witness_t<Builder>;
+
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+
+    // "I know x such that x^2 + x = y", with x private and y public.
+    static void create_leaf_circuit(Builder& builder, const fr& x)
+    {
+        field_ct x_ct(witness_ct(&builder, x));
+        field_ct y_ct(public_witness_ct(&builder, x.sqr() + x));
+        (x_ct * x_ct + x_ct).assert_equal(y_ct);
+    }
+
+    struct Leaves {
+        std::vector<plonk::proof> proofs;
+        std::vector<fr> public_inputs;
+        std::shared_ptr<plonk::verification_key> verification_key;
+    };
+
+    static Leaves create_leaves(size_t num_leaves)
+    {
+        Leaves leaves;
+        for (size_t i = 0; i < num_leaves; ++i) {
+            const fr x = fr::random_element();
+            Builder builder;
+            create_leaf_circuit(builder, x);
+            Composer composer;
+            auto prover = composer.create_prover(builder);
+            leaves.proofs.push_back(prover.construct_proof());
+            leaves.public_inputs.push_back(x.sqr() + x);
+            if (!leaves.verification_key) {
+                leaves.verification_key = composer.compute_verification_key(builder);
+            }
+        }
+        return leaves;
+    }
+
+    static void check_root(const AggregationTree::Node& root, const Leaves& leaves)
+    {
+        const auto& key = root.verification_key;
+        EXPECT_TRUE(key->contains_recursive_proof);
+        ASSERT_EQ(key->num_public_inputs, leaves.public_inputs.size() + 16);
+
+        // The root forwards the leaf public inputs, in leaf order, ahead of its aggregation object.
+        for (size_t i = 0; i < leaves.public_inputs.size(); ++i) {
+            EXPECT_EQ(fr::serialize_from_buffer(&root.proof.proof_data[i * 32]), leaves.public_inputs[i]);
+        }
+
+        EXPECT_TRUE(AggregationTree::verify(root));
+    }
+};
+
+HEAVY_TEST_F(AggregationTreeTests, FullTreeReusesProvingKeys)
+{
+    auto leaves = create_leaves(4);
+
+    AggregationTree tree(2);
+    auto root = tree.aggregate(leaves.proofs, leaves.verification_key);
+
+    check_root(root, leaves);
+    // Three nodes, but the two leaf-level nodes share a proving key.
+    EXPECT_EQ(tree.get_num_proving_keys_computed(), 2);
+}
+
+HEAVY_TEST_F(AggregationTreeTests, PartialNode)
+{
+    auto leaves = create_leaves(3);
+
+    AggregationTree tree(2);
+    auto root = tree.aggregate(leaves.proofs, leaves.verification_key);
+
+    check_root(root, leaves);
+    EXPECT_EQ(tree.get_num_proving_keys_computed(), 3);
+}
+
+/**
+ * A leaf level with at least one node per thread: the node circuits are built concurrently, and the node proofs used to
+ * be as well, which raced on the prover's shared FFT scratch space. Run with HARDWARE_CONCURRENCY set to bound the
+ * cost on large machines.
+ */
+HEAVY_TEST_F(AggregationTreeTests, NodePerThread)
+{
+    auto leaves = create_leaves(2 * std::max(get_num_cpus(), size_t(2)));
+
+    AggregationTree tree(2);
+    auto root = tree.aggregate(leaves.proofs, leaves.verification_key);
+
+    check_root(root, leaves);
+}
+
+HEAVY_TEST_F(AggregationTreeTests, TamperedLeafFails)
+{
+    auto leaves = create_leaves(2);
+    // Flip a bit of the second leaf's public input.
+    leaves.proofs[1].proof_data[31] ^= 1;
+
+    AggregationTree tree(2);
+    auto root = tree.aggregate(leaves.proofs, leaves.verification_key);
+
+    EXPECT_FALSE(AggregationTree::verify(root));
+}
+
+} // namespace proof_system::plonk::stdlib::recursion
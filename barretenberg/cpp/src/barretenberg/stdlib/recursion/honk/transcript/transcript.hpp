@@ -7,6 +7,7 @@
 
 #include "barretenberg/transcript/transcript.hpp"
 
+#include "barretenberg/stdlib/hash/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/primitives/bigfield/bigfield.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
@@ -19,6 +20,8 @@ template <typename Builder> class Transcript {
     using field_ct = field_t<Builder>;
     using FF = barretenberg::fr;
     using BaseTranscript = proof_system::honk::BaseTranscript;
+    using TranscriptLabel = proof_system::honk::TranscriptLabel;
+    using TranscriptHash = proof_system::honk::TranscriptHash;
     using StdlibTypes = utility::StdlibTypesUtility<Builder>;
 
     static constexpr size_t HASH_OUTPUT_SIZE = BaseTranscript::HASH_OUTPUT_SIZE;
@@ -28,8 +31,8 @@ template <typename Builder> class Transcript {
 
     Transcript() = default;
 
-    Transcript(Builder* builder, auto proof_data)
-        : native_transcript(proof_data)
+    Transcript(Builder* builder, auto proof_data, TranscriptHash hash_type = TranscriptHash::BLAKE3S)
+        : native_transcript(proof_data, hash_type)
         , builder(builder){};
 
     /**
@@ -52,15 +55,9 @@ template <typename Builder> class Transcript {
         std::array<uint256_t, num_challenges> native_challenges{};
         native_challenges = native_transcript.get_challenges(labels...);
 
-        /*
-         * TODO(#1351): Do stdlib hashing here. E.g., for the current pedersen/blake setup, we could write data into a
-         * byte_array as it is received from prover, then compress via pedersen and apply blake3s. Not doing this now
-         * since it's a pain and we'll be revamping our hashing anyway. For now, simply convert the native hashes to
-         * stdlib types without adding any hashing constraints.
-         */
         std::array<field_ct, num_challenges> challenges;
         for (size_t i = 0; i < num_challenges; ++i) {
-            challenges[i] = field_ct::from_witness(builder, static_cast<FF>(native_challenges[i]));
+            challenges[i] = compute_challenge(native_challenges[i]);
         }
 
         return challenges;
@@ -72,14 +69,12 @@ template <typename Builder> class Transcript {
      * @param label Name of challenge
      * @return field_ct Challenge
      */
-    field_ct get_challenge(const std::string& label)
+    field_ct get_challenge(const TranscriptLabel& label)
     {
         // Compute the indicated challenge from the native transcript
         auto native_challenge = native_transcript.get_challenge(label);
 
-        // TODO(1351): Stdlib hashing here...
-
-        return field_ct::from_witness(builder, native_challenge);
+        return compute_challenge(native_challenge);
     }
 
     /**
@@ -89,7 +84,7 @@ template <typename Builder> class Transcript {
      * @param label Name of the element
      * @return The corresponding element of appropriate stdlib type
      */
-    template <class T> auto receive_from_prover(const std::string& label)
+    template <class T> auto receive_from_prover(const TranscriptLabel& label)
     {
         // Get native type corresponding to input type
         using NativeType = typename StdlibTypes::template NativeType<T>::type;
@@ -98,7 +93,58 @@ template <typename Builder> class Transcript {
         NativeType element = native_transcript.template receive_from_prover<NativeType>(label);
 
         // Return the corresponding stdlib type
-        return StdlibTypes::from_witness(builder, element);
+        auto stdlib_element = StdlibTypes::from_witness(builder, element);
+        if (native_transcript.hash_type == TranscriptHash::POSEIDON2) {
+            append_field_elements(stdlib_element);
+        }
+        return stdlib_element;
+    }
+
+  private:
+    // In-circuit counterpart of the field elements absorbed by the native Poseidon2 transcript
+    std::vector<field_ct> field_elements;
+
+    /**
+     * @brief Constrain the next challenge to be the hash of the previous challenge and the data of the current round
+     * @details With a Poseidon2 transcript the challenge is recomputed in-circuit from the elements received so far,
+     * mirroring BaseTranscript::get_next_poseidon2_challenge.
+     *
+     * TODO(#1351): With a Blake3s transcript the native challenge is taken as a free witness; hashing the serialized
+     * proof in-circuit costs too much to be worth it, flavors that are verified recursively should use Poseidon2.
+     */
+    field_ct compute_challenge(const uint256_t& native_challenge)
+    {
+        if (native_transcript.hash_type != TranscriptHash::POSEIDON2) {
+            return field_ct::from_witness(builder, static_cast<FF>(native_challenge));
+        }
+        field_ct challenge = stdlib::poseidon2<Builder>::hash(*builder, field_elements);
+        ASSERT(challenge.get_value() == static_cast<FF>(native_challenge));
+        field_elements = { challenge };
+        return challenge;
+    }
+
+    /**
+     * @brief Append the field elements representing a received element, as in append_transcript_field_elements
+     * @details The coordinates of a group element are bigfields; each is absorbed as its low two and high two limbs,
+     * matching the 136-bit split of the native transcript.
+     */
+    template <typename T> void append_field_elements(const T& element)
+    {
+        if constexpr (std::same_as<T, field_ct>) {
+            field_elements.emplace_back(element);
+        } else if constexpr (requires { element.x.binary_basis_limbs; }) {
+            for (const auto& coordinate : { element.x, element.y }) {
+                const auto& limbs = coordinate.binary_basis_limbs;
+                field_elements.emplace_back(limbs[0].element + limbs[1].element * coordinate.shift_1);
+                field_elements.emplace_back(limbs[2].element + limbs[3].element * coordinate.shift_1);
+            }
+        } else if constexpr (requires { element.evaluations; }) {
+            append_field_elements(element.evaluations);
+        } else {
+            for (const auto& entry : element) {
+                append_field_elements(entry);
+            }
+        }
     }
 };
 } // namespace proof_system::plonk::stdlib::recursion::honk
@@ -97,10 +97,12 @@ TEST(RecursiveHonkTranscript, InterfacesMatch)
 
     // Instantiate a Prover Transcript and use it to generate some mock proof data
     BaseTranscript prover_transcript;
+    prover_transcript.record_manifest = true;
     auto proof_data = generate_mock_proof_data<UltraFlavor, LENGTH>(prover_transcript);
 
     // Instantiate a (native) Verifier Transcript with the proof data and perform some mock transcript operations
     BaseTranscript native_transcript(proof_data);
+    native_transcript.record_manifest = true;
     perform_mock_verifier_transcript_operations<UltraFlavor, LENGTH>(native_transcript);
 
     // Confirm that Prover and Verifier transcripts have generated the same manifest via the operations performed
@@ -108,6 +110,7 @@ TEST(RecursiveHonkTranscript, InterfacesMatch)
 
     // Instantiate a stdlib Transcript and perform the same operations
     Transcript<Builder> transcript{ &builder, proof_data };
+    transcript.native_transcript.record_manifest = true;
     perform_mock_verifier_transcript_operations<UltraRecursiveFlavor, LENGTH>(transcript);
 
     // Confirm that the native and stdlib verifier transcripts have generated the same manifest
@@ -176,4 +179,57 @@ TEST(RecursiveHonkTranscript, ReturnValuesMatch)
     EXPECT_EQ(static_cast<FF>(native_alpha), stdlib_alpha.get_value());
     EXPECT_EQ(static_cast<FF>(native_beta), stdlib_beta.get_value());
 }
+
+/**
+ * @brief Check that a Poseidon2 stdlib transcript derives the native challenges and constrains them in-circuit
+ *
+ */
+TEST(RecursiveHonkTranscript, Poseidon2ChallengesAreConstrained)
+{
+    using TranscriptHash = ::proof_system::honk::TranscriptHash;
+    using Commitment = barretenberg::g1::affine_element;
+    using field_ct = field_t<Builder>;
+    using fq_ct = bigfield<Builder, barretenberg::Bn254FqParams>;
+    using element_ct = element<Builder, fq_ct, field_ct, barretenberg::g1>;
+
+    Builder builder;
+
+    constexpr size_t LENGTH = 8; // arbitrary length of Univariate to be serialized
+    using Univariate = barretenberg::Univariate<FF, LENGTH>;
+    using Univariate_ct = barretenberg::Univariate<field_ct, LENGTH>;
+
+    auto commitment = Commitment::one() * FF::random_element();
+    std::array<FF, LENGTH> evaluations;
+    for (auto& eval : evaluations) {
+        eval = FF::random_element();
+    }
+
+    // Construct a mock proof via a Poseidon2 prover transcript
+    BaseTranscript prover_transcript(TranscriptHash::POSEIDON2);
+    prover_transcript.record_manifest = true;
+    prover_transcript.send_to_verifier("data", uint32_t(25));
+    prover_transcript.send_to_verifier("commitment", commitment);
+    auto [native_alpha, native_beta] = prover_transcript.get_challenges("alpha", "beta");
+    prover_transcript.send_to_verifier("univariate", Univariate(evaluations));
+    auto native_gamma = prover_transcript.get_challenge("gamma");
+
+    Transcript<Builder> transcript{ &builder, prover_transcript.proof_data, TranscriptHash::POSEIDON2 };
+    transcript.native_transcript.record_manifest = true;
+    transcript.template receive_from_prover<uint32_t>("data");
+    auto stdlib_commitment = transcript.template receive_from_prover<element_ct>("commitment");
+    auto [stdlib_alpha, stdlib_beta] = transcript.get_challenges("alpha", "beta");
+    transcript.template receive_from_prover<Univariate_ct>("univariate");
+    auto stdlib_gamma = transcript.get_challenge("gamma");
+
+    EXPECT_EQ(transcript.get_manifest(), prover_transcript.get_manifest());
+    EXPECT_EQ(commitment, stdlib_commitment.get_value());
+    EXPECT_EQ(static_cast<FF>(native_alpha), stdlib_alpha.get_value());
+    EXPECT_EQ(static_cast<FF>(native_beta), stdlib_beta.get_value());
+    EXPECT_EQ(static_cast<FF>(native_gamma), stdlib_gamma.get_value());
+    EXPECT_TRUE(builder.check_circuit());
+
+    // Unlike with a Blake3s transcript, the challenges are not free witnesses
+    builder.variables[builder.real_variable_index[stdlib_beta.witness_index]] += 1;
+    EXPECT_FALSE(builder.check_circuit());
+}
 } // namespace proof_system::plonk::stdlib::recursion::honk
\ No newline at end of file
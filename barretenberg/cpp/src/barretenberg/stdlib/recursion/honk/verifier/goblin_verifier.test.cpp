@@ -186,6 +186,7 @@ template <typename BuilderType> class GoblinRecursiveVerifierTest : public testi
         // Create a recursive verification circuit for the proof of the inner circuit
         OuterBuilder outer_circuit;
         RecursiveVerifier verifier{ &outer_circuit, instance->verification_key };
+        verifier.record_manifest = true;
         auto pairing_points = verifier.verify_proof(inner_proof);
 
         // Check for a failure flag in the recursive verifier circuit
@@ -194,6 +195,7 @@ template <typename BuilderType> class GoblinRecursiveVerifierTest : public testi
         // Check 1: Perform native verification then perform the pairing on the outputs of the recursive
         // verifier and check that the result agrees.
         auto native_verifier = inner_composer.create_verifier(instance);
+        native_verifier.record_manifest = true;
         auto native_result = native_verifier.verify_proof(inner_proof);
         auto recursive_result = native_verifier.pcs_verification_key->pairing_check(pairing_points[0].get_value(),
                                                                                     pairing_points[1].get_value());
@@ -18,16 +18,19 @@ template <typename CircuitBuilder>
 std::array<typename bn254<CircuitBuilder>::Element, 2> MergeRecursiveVerifier_<CircuitBuilder>::verify_proof(
     const plonk::proof& proof)
 {
-    transcript = std::make_shared<Transcript>(builder, proof.proof_data);
+    // The merge prover shares the transcript of the GoblinUltra prover
+    transcript = std::make_shared<Transcript>(
+        builder, proof.proof_data, ::proof_system::honk::flavor::GoblinUltra::TRANSCRIPT_HASH);
+    transcript->native_transcript.record_manifest = record_manifest;
 
     // Receive commitments [t_i^{shift}], [T_{i-1}], and [T_i]
     std::array<Commitment, NUM_WIRES> C_T_prev;
     std::array<Commitment, NUM_WIRES> C_t_shift;
     std::array<Commitment, NUM_WIRES> C_T_current;
     for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
-        C_T_prev[idx] = transcript->template receive_from_prover<Commitment>("T_PREV_" + std::to_string(idx + 1));
-        C_t_shift[idx] = transcript->template receive_from_prover<Commitment>("t_SHIFT_" + std::to_string(idx + 1));
-        C_T_current[idx] = transcript->template receive_from_prover<Commitment>("T_CURRENT_" + std::to_string(idx + 1));
+        C_T_prev[idx] = transcript->template receive_from_prover<Commitment>({ "T_PREV_", idx + 1 });
+        C_t_shift[idx] = transcript->template receive_from_prover<Commitment>({ "t_SHIFT_", idx + 1 });
+        C_T_current[idx] = transcript->template receive_from_prover<Commitment>({ "T_CURRENT_", idx + 1 });
     }
 
     FF kappa = transcript->get_challenge("kappa");
@@ -38,16 +41,16 @@ std::array<typename bn254<CircuitBuilder>::Element, 2> MergeRecursiveVerifier_<C
     std::array<FF, NUM_WIRES> T_current_evals;
     std::vector<OpeningClaim> opening_claims;
     for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
-        T_prev_evals[idx] = transcript->template receive_from_prover<FF>("T_prev_eval_" + std::to_string(idx + 1));
+        T_prev_evals[idx] = transcript->template receive_from_prover<FF>({ "T_prev_eval_", idx + 1 });
         opening_claims.emplace_back(OpeningClaim{ { kappa, T_prev_evals[idx] }, C_T_prev[idx] });
     }
     for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
-        t_shift_evals[idx] = transcript->template receive_from_prover<FF>("t_shift_eval_" + std::to_string(idx + 1));
+        t_shift_evals[idx] = transcript->template receive_from_prover<FF>({ "t_shift_eval_", idx + 1 });
         opening_claims.emplace_back(OpeningClaim{ { kappa, t_shift_evals[idx] }, C_t_shift[idx] });
     }
     for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
         T_current_evals[idx] =
-            transcript->template receive_from_prover<FF>("T_current_eval_" + std::to_string(idx + 1));
+            transcript->template receive_from_prover<FF>({ "T_current_eval_", idx + 1 });
         opening_claims.emplace_back(OpeningClaim{ { kappa, T_current_evals[idx] }, C_T_current[idx] });
     }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/commitment_schemes/kzg/kzg.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib/recursion/honk/transcript/transcript.hpp"
@@ -18,6 +19,7 @@ template <typename CircuitBuilder> class MergeRecursiveVerifier_ {
 
     CircuitBuilder* builder;
     std::shared_ptr<Transcript> transcript;
+    bool record_manifest = false; // record the transcript manifest while verifying, e.g. to compare it in tests
 
     static constexpr size_t NUM_WIRES = arithmetization::UltraHonk<FF>::NUM_WIRES;
 
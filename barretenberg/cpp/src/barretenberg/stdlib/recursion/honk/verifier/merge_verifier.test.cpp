@@ -55,6 +55,7 @@ class RecursiveMergeVerifierTest : public testing::Test {
         // Create a recursive merge verification circuit for the merge proof
         RecursiveBuilder outer_circuit;
         RecursiveMergeVerifier verifier{ &outer_circuit };
+        verifier.record_manifest = true;
         auto pairing_points = verifier.verify_proof(merge_proof);
 
         // Check for a failure flag in the recursive verifier circuit
@@ -63,6 +64,7 @@ class RecursiveMergeVerifierTest : public testing::Test {
         // Check 1: Perform native merge verification then perform the pairing on the outputs of the recursive merge
         // verifier and check that the result agrees.
         auto native_verifier = inner_composer.create_merge_verifier();
+        native_verifier.record_manifest = true;
         bool verified_native = native_verifier.verify_proof(merge_proof);
         VerifierCommitmentKey pcs_verification_key(0, srs::get_crs_factory());
         auto verified_recursive =
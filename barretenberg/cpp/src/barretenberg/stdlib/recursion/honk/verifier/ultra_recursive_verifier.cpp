@@ -31,7 +31,8 @@ std::array<typename Flavor::GroupElement, 2> UltraRecursiveVerifier_<Flavor>::ve
 
     RelationParams relation_parameters;
 
-    transcript = std::make_shared<Transcript>(builder, proof.proof_data);
+    transcript = std::make_shared<Transcript>(builder, proof.proof_data, Flavor::TRANSCRIPT_HASH);
+    transcript->native_transcript.record_manifest = record_manifest;
 
     VerifierCommitments commitments{ key };
     CommitmentLabels commitment_labels;
@@ -46,7 +47,7 @@ std::array<typename Flavor::GroupElement, 2> UltraRecursiveVerifier_<Flavor>::ve
 
     std::vector<FF> public_inputs;
     for (size_t i = 0; i < key->num_public_inputs; ++i) {
-        auto public_input_i = transcript->template receive_from_prover<FF>("public_input_" + std::to_string(i));
+        auto public_input_i = transcript->template receive_from_prover<FF>({ "public_input_", i });
         public_inputs.emplace_back(public_input_i);
     }
 
@@ -36,6 +36,7 @@ template <typename Flavor> class UltraRecursiveVerifier_ {
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     Builder* builder;
     std::shared_ptr<Transcript<Builder>> transcript;
+    bool record_manifest = false; // record the transcript manifest while verifying, e.g. to compare it in tests
 };
 
 // Instance declarations for Ultra and Goblin-Ultra verifier circuits with both conventional Ultra and Goblin-Ultra
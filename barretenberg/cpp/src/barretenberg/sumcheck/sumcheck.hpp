@@ -98,8 +98,8 @@ template <typename Flavor> class SumcheckProver {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
-            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            transcript->send_to_verifier({ "Sumcheck:univariate_", round_idx }, round_univariate);
+            FF round_challenge = transcript->get_challenge({ "Sumcheck:u_", round_idx });
             multivariate_challenge.emplace_back(round_challenge);
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
@@ -218,14 +218,13 @@ template <typename Flavor> class SumcheckVerifier {
 
         for (size_t round_idx = 0; round_idx < multivariate_d; round_idx++) {
             // Obtain the round univariate from the transcript
-            std::string round_univariate_label = "Sumcheck:univariate_" + std::to_string(round_idx);
             auto round_univariate =
                 transcript->template receive_from_prover<barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
-                    round_univariate_label);
+                    { "Sumcheck:univariate_", round_idx });
 
             bool checked = round.check_sum(round_univariate);
             verified = verified && checked;
-            FF round_challenge = transcript->get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            FF round_challenge = transcript->get_challenge({ "Sumcheck:u_", round_idx });
             multivariate_challenge.emplace_back(round_challenge);
 
             round.compute_next_target_sum(round_univariate, round_challenge);
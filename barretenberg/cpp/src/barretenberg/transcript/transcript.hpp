@@ -1,8 +1,16 @@
 #pragma once
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/serialize.hpp"
-#include "barretenberg/crypto/blake3s/blake3s.hpp"
-#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/crypto/blake3s_full/blake3s.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <optional>
+#include <span>
+#include <string_view>
 
 // #define LOG_CHALLENGES
 // #define LOG_INTERACTIONS
@@ -55,6 +63,82 @@ class TranscriptManifest {
     bool operator==(const TranscriptManifest& other) const = default;
 };
 
+/**
+ * @brief Name of a transcript element or challenge: a fixed prefix, optionally followed by an index
+ * @details Sumcheck round univariates, Gemini folds, ZeroMorph quotients and public inputs form indexed families.
+ * Instead of building a "prefix_i" string for every element sent or received, callers pass the prefix and the index,
+ * and the label is only rendered into a string if the manifest is recorded.
+ * @note The prefix is not copied, so a label must not outlive the call it is passed to.
+ */
+class TranscriptLabel {
+  public:
+    TranscriptLabel(const char* prefix) // NOLINT(google-explicit-constructor)
+        : prefix(prefix)
+    {}
+    TranscriptLabel(const std::string& prefix) // NOLINT(google-explicit-constructor)
+        : prefix(prefix)
+    {}
+    TranscriptLabel(std::string_view prefix, size_t index)
+        : prefix(prefix)
+        , index(index)
+    {}
+
+    [[nodiscard]] std::string to_string() const
+    {
+        std::string label(prefix);
+        if (index.has_value()) {
+            label += std::to_string(*index);
+        }
+        return label;
+    }
+
+  private:
+    std::string_view prefix;
+    std::optional<size_t> index;
+};
+
+/**
+ * @brief Hash used to derive the Fiat-Shamir challenges
+ * @details BLAKE3S absorbs the serialized bytes of each prover message. POSEIDON2 absorbs the messages as bn254 scalar
+ * field elements (see append_transcript_field_elements) and hashes them with the Poseidon2 sponge, so that a recursive
+ * verifier can derive the same challenges with a few Poseidon2 gates instead of a byte-oriented hash.
+ */
+enum class TranscriptHash { BLAKE3S, POSEIDON2 };
+
+/**
+ * @brief Append the bn254 scalar field elements representing a prover message to `elements`
+ * @details Integers and bn254 scalar field elements map to a single element. Elements of other fields (e.g. the bn254
+ * base field) are split into a low 136-bit and a high limb, which is how the recursive transcript reads the limbs of a
+ * bigfield. Group elements contribute their coordinates, univariates their evaluations and containers (including flavor
+ * entity classes, in the order of get_all()) their entries.
+ */
+template <typename T> void append_transcript_field_elements(std::vector<barretenberg::fr>& elements, const T& element)
+{
+    constexpr size_t LO_LIMB_BITS = 136;
+    if constexpr (std::is_integral_v<T>) {
+        elements.emplace_back(static_cast<uint64_t>(element));
+    } else if constexpr (std::same_as<T, barretenberg::fr>) {
+        elements.emplace_back(element);
+    } else if constexpr (requires { T::modulus; }) {
+        const auto value = static_cast<uint256_t>(element);
+        elements.emplace_back(value.slice(0, LO_LIMB_BITS));
+        elements.emplace_back(value.slice(LO_LIMB_BITS, 256));
+    } else if constexpr (requires { element.x; element.y; }) {
+        append_transcript_field_elements(elements, element.x);
+        append_transcript_field_elements(elements, element.y);
+    } else if constexpr (requires { element.evaluations; }) {
+        append_transcript_field_elements(elements, element.evaluations);
+    } else if constexpr (requires { element.get_all(); }) {
+        for (const auto& entry : element.get_all()) {
+            append_transcript_field_elements(elements, entry);
+        }
+    } else {
+        for (const auto& entry : element) {
+            append_transcript_field_elements(elements, entry);
+        }
+    }
+}
+
 /**
  * @brief Common transcript class for both parties. Stores the data for the current round, as well as the
  * manifest.
@@ -65,36 +149,59 @@ class BaseTranscript {
 
     BaseTranscript() = default;
 
+    explicit BaseTranscript(TranscriptHash hash_type)
+        : hash_type(hash_type)
+    {}
+
     /**
      * @brief Construct a new Base Transcript object for Verifier using proof_data
      *
      * @param proof_data
+     * @param hash_type must match the hash used by the prover
      */
-    explicit BaseTranscript(const Proof& proof_data)
-        : proof_data(proof_data.begin(), proof_data.end())
+    explicit BaseTranscript(const Proof& proof_data, TranscriptHash hash_type = TranscriptHash::BLAKE3S)
+        : hash_type(hash_type)
+        , proof_data(proof_data.begin(), proof_data.end())
     {}
     static constexpr size_t HASH_OUTPUT_SIZE = 32;
 
+    TranscriptHash hash_type = TranscriptHash::BLAKE3S;
+
     std::ptrdiff_t proof_start = 0;
     size_t num_bytes_written = 0; // the number of bytes written to proof_data by the prover or the verifier
     size_t num_bytes_read = 0;    // the number of bytes read from proof_data by the verifier
     size_t round_number = 0;      // current round for manifest
+    bool record_manifest = false; // the manifest is only needed to check the protocol structure (e.g. in tests)
 
   private:
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
     static constexpr size_t MIN_BYTES_PER_CHALLENGE = 128 / 8; // 128 bit challenges
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
-    std::array<uint8_t, HASH_OUTPUT_SIZE> previous_challenge_buffer{}; // default-initialized to zeros
-    std::vector<uint8_t> current_round_data;
+    size_t current_round_size = 0;  // the number of bytes absorbed since the last challenge
+
+    // Running hash state: the previous challenge (if any) followed by the data of the current round
+    blake3_full::blake3_hasher hasher = []() {
+        blake3_full::blake3_hasher initial_hasher;
+        blake3_full::blake3_hasher_init(&initial_hasher);
+        return initial_hasher;
+    }();
+
+    // Poseidon2 counterpart of the running hash state: the previous challenge (if any) followed by the field elements
+    // of the current round
+    std::vector<barretenberg::fr> field_elements;
 
     // "Manifest" object that records a summary of the transcript interactions
     TranscriptManifest manifest;
 
     /**
-     * @brief Compute next challenge c_next = H( Compress(c_prev || round_buffer) )
-     * @details This function computes a new challenge for the current round using the previous challenge
-     * and the current round data, if they are exist. It clears the current_round_data if nonempty after
-     * computing the challenge to minimize how much we compress. It also sets previous_challenge_buffer
-     * to the current challenge buffer to set up next function call.
+     * @brief Compute next challenge c_next = H( c_prev || round_buffer )
+     * @details The previous challenge and the round data have already been absorbed into the running hash state as
+     * they arrived, so this only finalizes the hash. The state is then reset and seeded with the new challenge, ready
+     * for the data of the next round.
+     * @note Earlier versions pre-hashed c_prev || round_buffer with Pedersen before applying Blake3s, to keep the input
+     * to Blake3s short. The incremental Blake3s absorbs inputs of any length, and hashing bytes with Pedersen costs a
+     * scalar multiplication per 31 bytes, so the pre-hash is gone.
      * @return std::array<uint8_t, HASH_OUTPUT_SIZE>
      */
     [[nodiscard]] std::array<uint8_t, HASH_OUTPUT_SIZE> get_next_challenge_buffer()
@@ -102,55 +209,94 @@ class BaseTranscript {
         // Prevent challenge generation if this is the first challenge we're generating,
         // AND nothing was sent by the prover.
         if (is_first_challenge) {
-            ASSERT(!current_round_data.empty());
+            ASSERT(current_round_size != 0);
+            is_first_challenge = false;
         }
 
-        // concatenate the previous challenge (if this is not the first challenge) with the current round data.
         // TODO(Adrian): Do we want to use a domain separator as the initial challenge buffer?
         // We could be cheeky and use the hash of the manifest as domain separator, which would prevent us from having
         // to domain separate all the data. (See https://safe-hash.dev)
-        std::vector<uint8_t> full_buffer;
-        if (!is_first_challenge) {
-            // if not the first challenge, we can use the previous_challenge_buffer
-            full_buffer.insert(full_buffer.end(), previous_challenge_buffer.begin(), previous_challenge_buffer.end());
-        } else {
-            // Update is_first_challenge for the future
+        std::array<uint8_t, HASH_OUTPUT_SIZE> new_challenge_buffer;
+        blake3_full::blake3_hasher_finalize(&hasher, new_challenge_buffer.data(), HASH_OUTPUT_SIZE);
+
+        // The next challenge is computed over this one followed by the data of the next round
+        blake3_full::blake3_hasher_init(&hasher);
+        blake3_full::blake3_hasher_update(&hasher, new_challenge_buffer.data(), HASH_OUTPUT_SIZE);
+        current_round_size = 0;
+
+        return new_challenge_buffer;
+    };
+
+    /**
+     * @brief Compute next challenge c_next = Poseidon2( c_prev || round_field_elements )
+     */
+    barretenberg::fr get_next_poseidon2_challenge()
+    {
+        if (is_first_challenge) {
+            ASSERT(current_round_size != 0);
             is_first_challenge = false;
         }
-        if (!current_round_data.empty()) {
-            full_buffer.insert(full_buffer.end(), current_round_data.begin(), current_round_data.end());
-            current_round_data.clear(); // clear the round data buffer since it has been used
-        }
 
-        // Pre-hash the full buffer to minimize the amount of data passed to the cryptographic hash function.
-        // Only a collision-resistant hash-function like Pedersen is required for this step.
-        // Note: this pre-hashing is an efficiency trick that may be discareded if using a SNARK-friendly or in contexts
-        // (eg smart contract verification) where the cost of elliptic curve operations is high.
-        std::vector<uint8_t> compressed_buffer = to_buffer(crypto::pedersen_hash::hash_buffer(full_buffer));
+        const barretenberg::fr challenge = Poseidon2::hash(field_elements);
+        field_elements = { challenge };
+        current_round_size = 0;
 
-        // Use a strong hash function to derive the new challenge_buffer.
-        auto base_hash = blake3::blake3s(compressed_buffer);
+        return challenge;
+    }
 
-        std::array<uint8_t, HASH_OUTPUT_SIZE> new_challenge_buffer;
-        std::copy_n(base_hash.begin(), HASH_OUTPUT_SIZE, new_challenge_buffer.begin());
-        // update previous challenge buffer for next time we call this function
-        previous_challenge_buffer = new_challenge_buffer;
-        return new_challenge_buffer;
-    };
+    /**
+     * @brief Compute the challenges of the current round and move on to the next round
+     */
+    template <size_t num_challenges> std::array<uint256_t, num_challenges> compute_challenges()
+    {
+        // Create challenges from bytes.
+        std::array<uint256_t, num_challenges> challenges{};
+
+        // Generate the challenges by iteratively hashing over the previous challenge.
+        for (size_t i = 0; i < num_challenges; i++) {
+            if (hash_type == TranscriptHash::POSEIDON2) {
+                challenges[i] = static_cast<uint256_t>(get_next_poseidon2_challenge());
+                continue;
+            }
+            auto next_challenge_buffer = get_next_challenge_buffer(); // get next challenge buffer
+            std::array<uint8_t, sizeof(uint256_t)> field_element_buffer{};
+            // copy half of the hash to lower 128 bits of challenge
+            // Note: because of how read() from buffers to fields works (in field_declarations.hpp),
+            // we use the later half of the buffer
+            std::copy_n(next_challenge_buffer.begin(),
+                        HASH_OUTPUT_SIZE / 2,
+                        field_element_buffer.begin() + HASH_OUTPUT_SIZE / 2);
+            challenges[i] = from_buffer<uint256_t>(field_element_buffer);
+        }
+
+        // Prepare for next round.
+        ++round_number;
+
+        return challenges;
+    }
 
   protected:
     /**
-     * @brief Adds challenge elements to the current_round_buffer and updates the manifest.
+     * @brief Absorbs a prover message into the running hash state and updates the manifest.
      *
      * @param label of the element sent
-     * @param element_bytes serialized
+     * @param element the message itself, absorbed as field elements by the Poseidon2 hash
+     * @param element_bytes serialized, absorbed by the Blake3s hash
      */
-    void consume_prover_element_bytes(const std::string& label, std::span<const uint8_t> element_bytes)
+    template <typename T>
+    void consume_prover_element(const TranscriptLabel& label, const T& element, std::span<const uint8_t> element_bytes)
     {
         // Add an entry to the current round of the manifest
-        manifest.add_entry(round_number, label, element_bytes.size());
+        if (record_manifest) {
+            manifest.add_entry(round_number, label.to_string(), element_bytes.size());
+        }
 
-        current_round_data.insert(current_round_data.end(), element_bytes.begin(), element_bytes.end());
+        if (hash_type == TranscriptHash::POSEIDON2) {
+            append_transcript_field_elements(field_elements, element);
+        } else {
+            blake3_full::blake3_hasher_update(&hasher, element_bytes.data(), element_bytes.size());
+        }
+        current_round_size += element_bytes.size();
 
         num_bytes_written += element_bytes.size();
     }
@@ -225,40 +371,19 @@ class BaseTranscript {
      */
     template <typename... Strings> std::array<uint256_t, sizeof...(Strings)> get_challenges(const Strings&... labels)
     {
-        constexpr size_t num_challenges = sizeof...(Strings);
-
         // Add challenge labels for current round to the manifest
-        manifest.add_challenge(round_number, labels...);
-
-        // Compute the new challenge buffer from which we derive the challenges.
-
-        // Create challenges from bytes.
-        std::array<uint256_t, num_challenges> challenges{};
-
-        // Generate the challenges by iteratively hashing over the previous challenge.
-        for (size_t i = 0; i < num_challenges; i++) {
-            auto next_challenge_buffer = get_next_challenge_buffer(); // get next challenge buffer
-            std::array<uint8_t, sizeof(uint256_t)> field_element_buffer{};
-            // copy half of the hash to lower 128 bits of challenge
-            // Note: because of how read() from buffers to fields works (in field_declarations.hpp),
-            // we use the later half of the buffer
-            std::copy_n(next_challenge_buffer.begin(),
-                        HASH_OUTPUT_SIZE / 2,
-                        field_element_buffer.begin() + HASH_OUTPUT_SIZE / 2);
-            challenges[i] = from_buffer<uint256_t>(field_element_buffer);
+        if (record_manifest) {
+            manifest.add_challenge(round_number, labels...);
         }
 
-        // Prepare for next round.
-        ++round_number;
-
-        return challenges;
+        return compute_challenges<sizeof...(Strings)>();
     }
 
     /**
      * @brief Adds a prover message to the transcript, only intended to be used by the prover.
      *
      * @details Serializes the provided object into `proof_data`, and updates the current round state in
-     * consume_prover_element_bytes.
+     * consume_prover_element.
      *
      * @param label Description/name of the object being added.
      * @param element Serializable object that will be added to the transcript
@@ -267,21 +392,23 @@ class BaseTranscript {
      * serializable.
      *
      */
-    template <class T> void send_to_verifier(const std::string& label, const T& element)
+    template <class T> void send_to_verifier(const TranscriptLabel& label, const T& element)
     {
         using serialize::write;
         // TODO(Adrian): Ensure that serialization of affine elements (including point at infinity) is consistent.
         // TODO(Adrian): Consider restricting serialization (via concepts) to types T for which sizeof(T) reliably
         // returns the size of T in bytes. (E.g. this is true for std::array but not for std::vector).
-        auto element_bytes = to_buffer(element);
-        proof_data.insert(proof_data.end(), element_bytes.begin(), element_bytes.end());
+        // Serialize straight into the proof and absorb the new bytes from there
+        const size_t offset = proof_data.size();
+        write(proof_data, element);
+        auto element_bytes = std::span{ proof_data }.subspan(offset);
 
 #ifdef LOG_INTERACTIONS
         if constexpr (Loggable<T>) {
-            info("sent:     ", label, ": ", element);
+            info("sent:     ", label.to_string(), ": ", element);
         }
 #endif
-        BaseTranscript::consume_prover_element_bytes(label, element_bytes);
+        BaseTranscript::consume_prover_element(label, element, element_bytes);
     }
 
     /**
@@ -290,7 +417,7 @@ class BaseTranscript {
      * @param label Human readable name for the challenge.
      * @return deserialized element of type T
      */
-    template <class T> T receive_from_prover(const std::string& label)
+    template <class T> T receive_from_prover(const TranscriptLabel& label)
     {
         constexpr size_t element_size = sizeof(T);
         ASSERT(num_bytes_read + element_size <= proof_data.size());
@@ -298,13 +425,13 @@ class BaseTranscript {
         auto element_bytes = std::span{ proof_data }.subspan(num_bytes_read, element_size);
         num_bytes_read += element_size;
 
-        BaseTranscript::consume_prover_element_bytes(label, element_bytes);
-
         T element = from_buffer<T>(element_bytes);
 
+        BaseTranscript::consume_prover_element(label, element, element_bytes);
+
 #ifdef LOG_INTERACTIONS
         if constexpr (Loggable<T>) {
-            info("received: ", label, ": ", element);
+            info("received: ", label.to_string(), ": ", element);
         }
 #endif
         return element;
@@ -312,13 +439,14 @@ class BaseTranscript {
 
     /**
      * @brief For testing: initializes transcript with some arbitrary data so that a challenge can be generated after
-     * initialization. Only intended to be used by Prover.
+     * initialization. Only intended to be used by Prover. The manifest is recorded.
      *
      * @return BaseTranscript
      */
     static std::shared_ptr<BaseTranscript> prover_init_empty()
     {
         auto transcript = std::make_shared<BaseTranscript>();
+        transcript->record_manifest = true;
         constexpr uint32_t init{ 42 }; // arbitrary
         transcript->send_to_verifier("Init", init);
         return transcript;
@@ -326,7 +454,7 @@ class BaseTranscript {
 
     /**
      * @brief For testing: initializes transcript based on proof data then receives junk data produced by
-     * BaseTranscript::prover_init_empty(). Only intended to be used by Verifier.
+     * BaseTranscript::prover_init_empty(). Only intended to be used by Verifier. The manifest is recorded.
      *
      * @param transcript
      * @return BaseTranscript
@@ -334,15 +462,20 @@ class BaseTranscript {
     static std::shared_ptr<BaseTranscript> verifier_init_empty(const std::shared_ptr<BaseTranscript>& transcript)
     {
         auto verifier_transcript = std::make_shared<BaseTranscript>(transcript->proof_data);
+        verifier_transcript->record_manifest = true;
         [[maybe_unused]] auto _ = verifier_transcript->template receive_from_prover<uint32_t>("Init");
         return verifier_transcript;
     };
 
-    uint256_t get_challenge(const std::string& label)
+    uint256_t get_challenge(const TranscriptLabel& label)
     {
-        uint256_t result = get_challenges(label)[0];
+        if (record_manifest) {
+            const std::string label_string = label.to_string();
+            manifest.add_challenge(round_number, label_string);
+        }
+        uint256_t result = compute_challenges<1>()[0];
 #if defined LOG_CHALLENGES || defined LOG_INTERACTIONS
-        info("challenge: ", label, ": ", result);
+        info("challenge: ", label.to_string(), ": ", result);
 #endif
         return result;
     }
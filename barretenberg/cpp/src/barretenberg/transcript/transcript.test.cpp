@@ -48,4 +48,58 @@ TEST(BaseTranscript, TwoProversTwoFields)
     EXPECT_EQ(received_b, elt_b);
 }
 
+/**
+ * @brief Test that prover and verifier derive the same challenges from rounds of any size, with or without recording
+ * the manifest, and that the challenges depend on the data of the round
+ *
+ */
+void check_challenges_agree(proof_system::honk::TranscriptHash hash_type)
+{
+    // More than the 1024 bytes that fit into a single Blake3s chunk
+    constexpr size_t num_elements = 100;
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element();
+    }
+
+    const auto prove = [&](bool record_manifest) {
+        Transcript prover_transcript{ hash_type };
+        prover_transcript.record_manifest = record_manifest;
+        for (size_t i = 0; i < num_elements; ++i) {
+            prover_transcript.send_to_verifier({ "element_", i }, elements[i]);
+        }
+        auto [alpha, beta] = prover_transcript.get_challenges("alpha", "beta");
+        prover_transcript.send_to_verifier("last", elements[0]);
+        auto gamma = prover_transcript.get_challenge("gamma");
+        return std::make_tuple(prover_transcript, std::array<uint256_t, 3>{ alpha, beta, gamma });
+    };
+
+    auto [prover_transcript, prover_challenges] = prove(/*record_manifest=*/false);
+    EXPECT_EQ(prover_transcript.get_manifest().size(), 0);
+    EXPECT_NE(prover_challenges[0], prover_challenges[1]);
+    EXPECT_EQ(std::get<1>(prove(/*record_manifest=*/true)), prover_challenges);
+
+    Transcript verifier_transcript{ prover_transcript.export_proof(), hash_type };
+    for (size_t i = 0; i < num_elements; ++i) {
+        EXPECT_EQ(verifier_transcript.receive_from_prover<Fr>({ "element_", i }), elements[i]);
+    }
+    auto [alpha, beta] = verifier_transcript.get_challenges("alpha", "beta");
+    verifier_transcript.receive_from_prover<Fr>("last");
+    auto gamma = verifier_transcript.get_challenge("gamma");
+    EXPECT_EQ((std::array<uint256_t, 3>{ alpha, beta, gamma }), prover_challenges);
+
+    elements[num_elements - 1] += 1;
+    EXPECT_NE(std::get<1>(prove(/*record_manifest=*/false))[0], prover_challenges[0]);
+}
+
+TEST(BaseTranscript, ChallengesAgree)
+{
+    check_challenges_agree(proof_system::honk::TranscriptHash::BLAKE3S);
+}
+
+TEST(BaseTranscript, Poseidon2ChallengesAgree)
+{
+    check_challenges_agree(proof_system::honk::TranscriptHash::POSEIDON2);
+}
+
 } // namespace barretenberg::honk_transcript_tests
@@ -142,6 +142,28 @@ TEST_F(GoblinUltraHonkComposerTests, MultipleCircuitsMergeOnly)
     }
 }
 
+/**
+ * @brief A merge prover constructed directly, with its default transcript, produces proofs that the merge verifier
+ * accepts
+ *
+ */
+TEST_F(GoblinUltraHonkComposerTests, MergeProverDefaultTranscript)
+{
+    auto op_queue = std::make_shared<proof_system::ECCOpQueue>();
+    op_queue->populate_with_mock_initital_data();
+
+    auto builder = proof_system::GoblinUltraCircuitBuilder{ op_queue };
+    generate_test_circuit(builder);
+
+    auto composer = GoblinUltraComposer();
+    op_queue->set_size_data();
+    auto commitment_key = composer.compute_commitment_key(op_queue->get_current_size());
+    auto merge_prover = MergeProver_<flavor::GoblinUltra>(commitment_key, op_queue);
+    auto merge_verifier = composer.create_merge_verifier();
+    auto merge_proof = merge_prover.construct_proof();
+    EXPECT_TRUE(merge_verifier.verify_proof(merge_proof));
+}
+
 /**
  * @brief Test Honk proof construction/verification for multiple circuits with ECC op gates, public inputs, and
  * basic arithmetic gates
@@ -138,6 +138,7 @@ TEST_F(GoblinUltraTranscriptTests, ProverManifestConsistency)
     auto composer = GoblinUltraComposer();
     auto instance = composer.create_instance(builder);
     auto prover = composer.create_prover(instance);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Check that the prover generated manifest agrees with the manifest hard coded in this suite
@@ -165,10 +166,12 @@ TEST_F(GoblinUltraTranscriptTests, VerifierManifestConsistency)
     auto composer = GoblinUltraComposer();
     auto instance = composer.create_instance(builder);
     auto prover = composer.create_prover(instance);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Automatically generate a transcript manifest in the verifier by verifying a proof
     auto verifier = composer.create_verifier(instance);
+    verifier.record_manifest = true;
     verifier.verify_proof(proof);
 
     // Check consistency between the manifests generated by the prover and verifier
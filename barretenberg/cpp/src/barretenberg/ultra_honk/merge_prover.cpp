@@ -56,10 +56,9 @@ template <typename Flavor> plonk::proof& MergeProver_<Flavor>::construct_proof()
         // Compute updated aggregate transcript commitment as [T_i] = [T_{i-1}] + [t_i^{shift}]
         C_T_current[idx] = C_T_prev + C_t_shift;
 
-        std::string suffix = std::to_string(idx + 1);
-        transcript->send_to_verifier("T_PREV_" + suffix, C_T_prev);
-        transcript->send_to_verifier("t_SHIFT_" + suffix, C_t_shift);
-        transcript->send_to_verifier("T_CURRENT_" + suffix, C_T_current[idx]);
+        transcript->send_to_verifier({ "T_PREV_", idx + 1 }, C_T_prev);
+        transcript->send_to_verifier({ "t_SHIFT_", idx + 1 }, C_t_shift);
+        transcript->send_to_verifier({ "T_CURRENT_", idx + 1 }, C_T_current[idx]);
     }
 
     // Store the commitments [T_{i}] (to be used later in subsequent iterations as [T_{i-1}]).
@@ -75,20 +74,20 @@ template <typename Flavor> plonk::proof& MergeProver_<Flavor>::construct_proof()
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
         auto polynomial = Polynomial(T_prev[idx]);
         auto evaluation = polynomial.evaluate(kappa);
-        transcript->send_to_verifier("T_prev_eval_" + std::to_string(idx + 1), evaluation);
+        transcript->send_to_verifier({ "T_prev_eval_", idx + 1 }, evaluation);
         opening_claims.emplace_back(OpeningClaim{ polynomial, { kappa, evaluation } });
     }
     // Compute evaluation t_i^{shift}(\kappa)
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
         auto evaluation = t_shift[idx].evaluate(kappa);
-        transcript->send_to_verifier("t_shift_eval_" + std::to_string(idx + 1), evaluation);
+        transcript->send_to_verifier({ "t_shift_eval_", idx + 1 }, evaluation);
         opening_claims.emplace_back(OpeningClaim{ t_shift[idx], { kappa, evaluation } });
     }
     // Compute evaluation T_i(\kappa)
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
         auto polynomial = Polynomial(T_current[idx]);
         auto evaluation = polynomial.evaluate(kappa);
-        transcript->send_to_verifier("T_current_eval_" + std::to_string(idx + 1), evaluation);
+        transcript->send_to_verifier({ "T_current_eval_", idx + 1 }, evaluation);
         opening_claims.emplace_back(OpeningClaim{ polynomial, { kappa, evaluation } });
     }
 
@@ -21,15 +21,16 @@ MergeVerifier_<Flavor>::MergeVerifier_()
 template <typename Flavor> bool MergeVerifier_<Flavor>::verify_proof(const plonk::proof& proof)
 {
     transcript = std::make_shared<Transcript>(proof.proof_data);
+    transcript->record_manifest = record_manifest;
 
     // Receive commitments [t_i^{shift}], [T_{i-1}], and [T_i]
     std::array<Commitment, Flavor::NUM_WIRES> C_T_prev;
     std::array<Commitment, Flavor::NUM_WIRES> C_t_shift;
     std::array<Commitment, Flavor::NUM_WIRES> C_T_current;
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
-        C_T_prev[idx] = transcript->template receive_from_prover<Commitment>("T_PREV_" + std::to_string(idx + 1));
-        C_t_shift[idx] = transcript->template receive_from_prover<Commitment>("t_SHIFT_" + std::to_string(idx + 1));
-        C_T_current[idx] = transcript->template receive_from_prover<Commitment>("T_CURRENT_" + std::to_string(idx + 1));
+        C_T_prev[idx] = transcript->template receive_from_prover<Commitment>({ "T_PREV_", idx + 1 });
+        C_t_shift[idx] = transcript->template receive_from_prover<Commitment>({ "t_SHIFT_", idx + 1 });
+        C_T_current[idx] = transcript->template receive_from_prover<Commitment>({ "T_CURRENT_", idx + 1 });
     }
 
     FF kappa = transcript->get_challenge("kappa");
@@ -40,16 +41,16 @@ template <typename Flavor> bool MergeVerifier_<Flavor>::verify_proof(const plonk
     std::array<FF, Flavor::NUM_WIRES> T_current_evals;
     std::vector<OpeningClaim> opening_claims;
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
-        T_prev_evals[idx] = transcript->template receive_from_prover<FF>("T_prev_eval_" + std::to_string(idx + 1));
+        T_prev_evals[idx] = transcript->template receive_from_prover<FF>({ "T_prev_eval_", idx + 1 });
         opening_claims.emplace_back(pcs::OpeningClaim<Curve>{ { kappa, T_prev_evals[idx] }, C_T_prev[idx] });
     }
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
-        t_shift_evals[idx] = transcript->template receive_from_prover<FF>("t_shift_eval_" + std::to_string(idx + 1));
+        t_shift_evals[idx] = transcript->template receive_from_prover<FF>({ "t_shift_eval_", idx + 1 });
         opening_claims.emplace_back(pcs::OpeningClaim<Curve>{ { kappa, t_shift_evals[idx] }, C_t_shift[idx] });
     }
     for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
         T_current_evals[idx] =
-            transcript->template receive_from_prover<FF>("T_current_eval_" + std::to_string(idx + 1));
+            transcript->template receive_from_prover<FF>({ "T_current_eval_", idx + 1 });
         opening_claims.emplace_back(pcs::OpeningClaim<Curve>{ { kappa, T_current_evals[idx] }, C_T_current[idx] });
     }
 
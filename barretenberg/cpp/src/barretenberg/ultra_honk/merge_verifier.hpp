@@ -31,6 +31,7 @@ template <typename Flavor> class MergeVerifier_ {
     std::shared_ptr<Transcript> transcript;
     std::shared_ptr<ECCOpQueue> op_queue;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
+    bool record_manifest = false; // record the transcript manifest while verifying, e.g. to compare it in tests
 
     explicit MergeVerifier_();
     bool verify_proof(const plonk::proof& proof);
@@ -118,6 +118,45 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test batch verification of several proofs of the same circuit, with and without an invalid proof
+ *
+ */
+TEST_F(UltraHonkComposerTests, BatchVerifyProofs)
+{
+    const auto create_circuit = []() {
+        auto builder = proof_system::UltraCircuitBuilder();
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = builder.add_public_variable(a);
+        uint32_t b_idx = builder.add_variable(b);
+        uint32_t c_idx = builder.add_variable(a * b);
+        builder.create_poly_gate({ a_idx, b_idx, c_idx, fr(1), fr(0), fr(0), fr(-1), fr(0) });
+        return builder;
+    };
+
+    constexpr size_t num_proofs = 4;
+    auto composer = UltraComposer();
+    std::vector<proof_system::plonk::proof> proofs;
+    std::optional<UltraVerifier> verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto builder = create_circuit();
+        auto instance = composer.create_instance(builder);
+        auto prover = composer.create_prover(instance);
+        proofs.emplace_back(prover.construct_proof());
+        if (!verifier.has_value()) {
+            verifier.emplace(composer.create_verifier(instance));
+        }
+    }
+
+    EXPECT_TRUE(verifier->batch_verify_proofs(proofs));
+
+    // Alter the public input of one proof (it follows the circuit size, public input size and offset).
+    proofs[1].proof_data[3 * sizeof(uint32_t) + 31] ^= 1;
+    EXPECT_FALSE(verifier->verify_proof(proofs[1]));
+    EXPECT_FALSE(verifier->batch_verify_proofs(proofs));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = proof_system::UltraCircuitBuilder();
@@ -38,7 +38,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_preamble_round(
 
     for (size_t i = 0; i < proving_key->num_public_inputs; ++i) {
         auto public_input_i = instance->public_inputs[i];
-        transcript->send_to_verifier("public_input_" + std::to_string(i), public_input_i);
+        transcript->send_to_verifier({ "public_input_", i }, public_input_i);
     }
 }
 
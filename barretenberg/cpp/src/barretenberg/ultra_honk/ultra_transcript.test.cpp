@@ -124,6 +124,7 @@ TEST_F(UltraTranscriptTests, ProverManifestConsistency)
     auto composer = UltraComposer();
     auto instance = composer.create_instance(builder);
     auto prover = composer.create_prover(instance);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Check that the prover generated manifest agrees with the manifest hard coded in this suite
@@ -151,10 +152,12 @@ TEST_F(UltraTranscriptTests, VerifierManifestConsistency)
     auto composer = UltraComposer();
     auto instance = composer.create_instance(builder);
     auto prover = composer.create_prover(instance);
+    prover.transcript->record_manifest = true;
     auto proof = prover.construct_proof();
 
     // Automatically generate a transcript manifest in the verifier by verifying a proof
     auto verifier = composer.create_verifier(instance);
+    verifier.record_manifest = true;
     verifier.verify_proof(proof);
 
     // Check consistency between the manifests generated by the prover and verifier
@@ -223,3 +226,28 @@ TEST_F(UltraTranscriptTests, StructureTest)
     prover.transcript->deserialize_full_transcript();
     EXPECT_EQ(static_cast<Flavor::Commitment>(prover.transcript->sorted_accum_comm), one_group_val * rand_val);
 }
+
+/**
+ * @brief Check that the proof has the length given by the flavor's proof layout, and that proofs of any other length
+ * are rejected before they are read
+ */
+TEST_F(UltraTranscriptTests, ProofLength)
+{
+    auto builder = typename Flavor::CircuitBuilder();
+    generate_test_circuit(builder);
+
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto prover = composer.create_prover(instance);
+    auto proof = prover.construct_proof();
+    const size_t log_n = numeric::get_msb(instance->proving_key->circuit_size);
+    EXPECT_EQ(proof.proof_data.size(), Flavor::proof_length(log_n, instance->proving_key->num_public_inputs));
+
+    auto verifier = composer.create_verifier(instance);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    proof.proof_data.push_back(0);
+    EXPECT_FALSE(verifier.verify_proof(proof));
+    proof.proof_data.resize(proof.proof_data.size() - sizeof(Flavor::Commitment) - 1);
+    EXPECT_FALSE(verifier.verify_proof(proof));
+}
@@ -32,12 +32,14 @@ template <typename Flavor>
 UltraVerifier_<Flavor>::UltraVerifier_(UltraVerifier_&& other)
     : key(std::move(other.key))
     , pcs_verification_key(std::move(other.pcs_verification_key))
+    , record_manifest(other.record_manifest)
 {}
 
 template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::operator=(UltraVerifier_&& other)
 {
     key = other.key;
     pcs_verification_key = (std::move(other.pcs_verification_key));
+    record_manifest = other.record_manifest;
     commitments.clear();
     return *this;
 }
@@ -47,6 +49,42 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk::proof& proof)
+{
+    auto pairing_points = compute_pairing_points(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+/**
+ * @brief Verifies several Ultra Honk proofs against the same key, sharing a single final exponentiation.
+ * @details Each proof is reduced to its ZeroMorph pairing points, and the pairing checks are then combined with random
+ * scalars. Returns false if any proof fails sumcheck or if the combined pairing check fails.
+ */
+template <typename Flavor> bool UltraVerifier_<Flavor>::batch_verify_proofs(const std::vector<plonk::proof>& proofs)
+{
+    std::vector<barretenberg::pairing::pairing_points> points;
+    points.reserve(proofs.size());
+    for (const auto& proof : proofs) {
+        auto pairing_points = compute_pairing_points(proof);
+        if (!pairing_points.has_value()) {
+            return false;
+        }
+        points.emplace_back(*pairing_points);
+    }
+    return pcs_verification_key->batch_pairing_check(points);
+}
+
+/**
+ * @brief Runs the Ultra Honk verifier up to (but excluding) the final pairing check.
+ *
+ * @return The points P₀, P₁ of the ZeroMorph pairing check e(P₀,[1]₁)e(P₁,[x]₂) ≡ [1]ₜ, or std::nullopt if the proof
+ * is rejected before the pairing check (mismatched circuit size, failed sumcheck, ...).
+ */
+template <typename Flavor>
+std::optional<barretenberg::pairing::pairing_points> UltraVerifier_<Flavor>::compute_pairing_points(
+    const plonk::proof& proof)
 {
     using FF = typename Flavor::FF;
     using Commitment = typename Flavor::Commitment;
@@ -58,6 +96,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
     proof_system::RelationParameters<FF> relation_parameters;
 
     transcript = std::make_shared<Transcript>(proof.proof_data);
+    transcript->record_manifest = record_manifest;
 
     VerifierCommitments commitments{ key };
     CommitmentLabels commitment_labels;
@@ -68,15 +107,18 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
     const auto pub_inputs_offset = transcript->template receive_from_prover<uint32_t>("pub_inputs_offset");
 
     if (circuit_size != key->circuit_size) {
-        return false;
+        return std::nullopt;
     }
     if (public_input_size != key->num_public_inputs) {
-        return false;
+        return std::nullopt;
+    }
+    if (proof.proof_data.size() != Flavor::proof_length(numeric::get_msb(circuit_size), public_input_size)) {
+        return std::nullopt;
     }
 
     std::vector<FF> public_inputs;
     for (size_t i = 0; i < public_input_size; ++i) {
-        auto public_input_i = transcript->template receive_from_prover<FF>("public_input_" + std::to_string(i));
+        auto public_input_i = transcript->template receive_from_prover<FF>({ "public_input_", i });
         public_inputs.emplace_back(public_input_i);
     }
 
@@ -137,9 +179,9 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
         sumcheck.verify(relation_parameters, alpha, transcript);
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
         info("UltraVerifier: Sumcheck failed.");
-        return false;
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds. See https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the
@@ -151,9 +193,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
                                             multivariate_challenge,
                                             transcript);
 
-    auto verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_verified.value() && verified;
+    return barretenberg::pairing::pairing_points{ pairing_points[0], pairing_points[1] };
 }
 
 template class UltraVerifier_<honk::flavor::Ultra>;
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
@@ -23,11 +24,14 @@ template <typename Flavor> class UltraVerifier_ {
     UltraVerifier_& operator=(UltraVerifier_&& other);
 
     bool verify_proof(const plonk::proof& proof);
+    bool batch_verify_proofs(const std::vector<plonk::proof>& proofs);
+    std::optional<barretenberg::pairing::pairing_points> compute_pairing_points(const plonk::proof& proof);
 
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     std::shared_ptr<Transcript> transcript;
+    bool record_manifest = false; // record the transcript manifest while verifying, e.g. to compare it in tests
 };
 
 extern template class UltraVerifier_<honk::flavor::Ultra>;
@@ -60,4 +60,32 @@ TEST_F(AvmMiniTests, basic)
     }
 }
 
+/**
+ * @brief finalize() resets the trace builder, so that a second trace built with the same object
+ *        starts from an empty state and is valid.
+ */
+TEST_F(AvmMiniTests, reuseAfterFinalize)
+{
+    auto trace_builder = proof_system::AvmMiniTraceBuilder();
+
+    trace_builder.callDataCopy(0, 2, 1, std::vector<FF>{ 45, 23 });
+    trace_builder.add(1, 2, 3);
+    trace_builder.returnOP(3, 1);
+    auto first_trace = trace_builder.finalize();
+
+    trace_builder.callDataCopy(0, 3, 2, std::vector<FF>{ 45, 23, 12 });
+    trace_builder.add(2, 3, 4);
+    auto second_trace = trace_builder.finalize();
+
+    auto circuit_builder = proof_system::AvmMiniCircuitBuilder();
+    circuit_builder.set_trace(std::move(first_trace));
+    EXPECT_TRUE(circuit_builder.check_circuit());
+
+    // The clock of the second trace starts again from zero
+    EXPECT_EQ(second_trace.at(1).avmMini_clk, FF(0));
+    EXPECT_EQ(second_trace.at(2).avmMini_clk, FF(1));
+    circuit_builder.set_trace(std::move(second_trace));
+    EXPECT_TRUE(circuit_builder.check_circuit());
+}
+
 } // namespace example_relation_honk_composer
\ No newline at end of file